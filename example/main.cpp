@@ -4,16 +4,18 @@
 #include "fonttik/Configuration.hpp"
 #include "fonttik/Media.hpp"
 #include "fonttik/Log.h"
+#include "fonttik/BatchScheduler.hpp"
+#include "fonttik/SharedMemoryMedia.hpp"
+#include "fonttik/StreamMedia.hpp"
+#include "fonttik/ImageSequence.hpp"
 
 #include <iostream>
+#include <fstream>
 #include <algorithm>
 #include <filesystem>
-#include <regex>
 
 namespace fs = std::filesystem;
 
-const std::regex outputDir("_output$"); //ignored directories
-
 char* getCmdOption(char** begin, char** end, const std::string& option)
 {
 	char** itr = std::find(begin, end, option);
@@ -29,63 +31,192 @@ bool cmdOptionExists(char** begin, char** end, const std::string& option)
 	return std::find(begin, end, option) != end;
 }
 
-void processMedia(tik::Fonttik& fonttik, fs::path path, tik::Configuration& config, bool async) 
+void analyseMedia(tik::Fonttik& fonttik, tik::Media& media, bool async)
 {
-	tik::Media* media = tik::Media::createMedia(path.string(), fonttik.colorblindFilters);
+	if (async) 
+	{
+		fonttik.processMediaAsync(media);
+	}
+	else 
+	{
+		tik::Results results = fonttik.processMedia(media);
+		fonttik.saveResults(media, results);
+		LOG_CORE_INFO("Storing json");
+		fonttik.saveResultsToJson(media.getOutputPath(), results);
+	}
+}
+
+bool processMedia(tik::Fonttik& fonttik, fs::path path, tik::Configuration& config, bool async) 
+{
+	tik::Media* media = tik::Media::createMedia(path.string(), fonttik.getColorblindFilters());
 	
 	if (media != nullptr) 
 	{
-		if (async) 
-		{
-			fonttik.processMediaAsync(*media);
-		}
-		else 
-		{
-			tik::Results results = fonttik.processMedia(*media);
-			fonttik.saveResults(*media, results);
-			LOG_CORE_INFO("Storing json");
-			fonttik.saveResultsToJson(media->getOutputPath(), results);
-		}
+		analyseMedia(fonttik, *media, async);
 		delete media;		
+		return true;
 	}
 	else
 	{
 		LOG_CORE_ERROR("{0} format is not supported", path.filename().string());
+		return false;
 	}
 }
 
-//Recursively analyze all files in folder except for subfolders which correspond to outputs
-void processFolder(tik::Fonttik& fonttik, fs::path path, tik::Configuration& config, bool async) {
-	for (const auto& directoryEntry : fs::directory_iterator(path)) {
-		if (fs::is_regular_file(directoryEntry)) {
-			processMedia(fonttik, directoryEntry, config, async);
+//Analyses the newest frame published by a capture process until it closes the ring. Asynchronous analysis stores outlines
+//and results of every frame, otherwise only the results are stored once the ring closes, its frames are gone by then
+bool processSharedMemory(tik::Fonttik& fonttik, const std::string& name, bool async)
+{
+	std::unique_ptr<tik::SharedMemoryMedia> media(tik::SharedMemoryMedia::open(name, fonttik.getColorblindFilters()));
+	if (media == nullptr)
+	{
+		return false;
+	}
+
+	if (async)
+	{
+		fonttik.processMediaAsync(*media);
+		LOG_CORE_INFO("{0} frames dropped", media->getDroppedFrames());
+		return true;
+	}
+
+	if (!fonttik.beginMedia(*media))
+	{
+		return false;
+	}
+
+	tik::Results results;
+	while (media->loadFrame())
+	{
+		std::pair<tik::FrameResults, tik::FrameResults> frameResults = fonttik.processFrame(*media);
+		LOG_CORE_INFO("Size {0}, contrast {1}, {2} frames dropped so far", tik::ResultTypeAsString(frameResults.first.overallType),
+			tik::ResultTypeAsString(frameResults.second.overallType), media->getDroppedFrames());
+		results.addSizeResults(frameResults.first);
+		results.addContrastResults(frameResults.second);
+	}
+	fonttik.saveResultsToJson(media->getOutputPath(), results);
+	return true;
+}
+
+//Analyses the images of a folder, or the files matching a printf-style pattern, as the frames of one video.
+//order is natural (default), name or time, --fps sets the frame rate used for frame skipping and the output videos
+bool processSequence(tik::Fonttik& fonttik, const fs::path& path, const char* order, const char* fps, bool async)
+{
+	const double frameRate = fps ? std::atof(fps) : tik::ImageSequence::DEFAULT_FPS;
+	std::unique_ptr<tik::ImageSequence> sequence;
+	if (fs::is_directory(path))
+	{
+		tik::SequenceOrder sequenceOrder = tik::SequenceOrder::Natural;
+		if (order && std::string(order) == "name")
+		{
+			sequenceOrder = tik::SequenceOrder::Name;
 		}
-		//Ignore output results
-		else if (fs::is_directory(directoryEntry)) {
-			//Avoid endless recursion produced by analysing results and producing more results to analyse
-			if (std::regex_search(directoryEntry.path().string(), outputDir)) {
-				LOG_CORE_TRACE("{0} is already a results folder", directoryEntry.path().string());
-			}
-			else {
-				processFolder(fonttik, directoryEntry, config, async);
-			}
+		else if (order && std::string(order) == "time")
+		{
+			sequenceOrder = tik::SequenceOrder::ModifiedTime;
 		}
+		sequence.reset(tik::ImageSequence::fromDirectory(path, sequenceOrder, frameRate));
+	}
+	else
+	{
+		sequence.reset(tik::ImageSequence::fromPattern(path.string(), frameRate));
+	}
+
+	if (sequence == nullptr)
+	{
+		return false;
+	}
+
+	analyseMedia(fonttik, *sequence, async);
+	return true;
+}
+
+//Analyses the frames piped to stdin or a named pipe as they arrive and writes the results of each one as a JSON line
+bool processStream(tik::Fonttik& fonttik, const std::string& source, const tik::StreamFormat& format, std::ostream& out)
+{
+	std::unique_ptr<tik::StreamMedia> media(tik::StreamMedia::open(source, format, fonttik.getColorblindFilters()));
+	if (media == nullptr || !fonttik.beginMedia(*media))
+	{
+		return false;
+	}
+
+	while (media->loadFrame())
+	{
+		fonttik.writeResultsLine(out, fonttik.processFrame(*media));
 	}
+	return true;
 }
 
+//Reads the raw frame layout from --size WxH, --fps and --pix-fmt (bgr24, bgra or rgba as ffmpeg names them)
+tik::StreamFormat getStreamFormat(char** begin, char** end)
+{
+	tik::StreamFormat format;
+
+	char* size = getCmdOption(begin, end, "--size");
+	if (size)
+	{
+		std::sscanf(size, "%dx%d", &format.frameSize.width, &format.frameSize.height);
+	}
+
+	char* fps = getCmdOption(begin, end, "--fps");
+	if (fps)
+	{
+		format.fps = std::atof(fps);
+	}
+
+	char* pixelFormat = getCmdOption(begin, end, "--pix-fmt");
+	if (pixelFormat && std::string(pixelFormat) == "bgra")
+	{
+		format.format = tik::PixelFormat::BGRA;
+	}
+	else if (pixelFormat && std::string(pixelFormat) == "rgba")
+	{
+		format.format = tik::PixelFormat::RGBA;
+	}
+	return format;
+}
 
 int main(int argc, char* argv[]) {
 	tik::Log::InitCoreLogger(true, false, 1, nullptr, "%^[%l] %v%$");
+
+	char* streamSource = getCmdOption(argv, argv + argc, "--stream"); //frames piped from stdin (-) or a named pipe
+	char* ndjsonPath = getCmdOption(argv, argv + argc, "--ndjson"); //streamed results go to stdout unless a file is given
+
+	if (streamSource && !ndjsonPath)
+	{
+		//Logs move to stderr so stdout only carries results
+		auto& sinks = tik::Log::GetCoreLogger()->sinks();
+		sinks.clear();
+		sinks.push_back(std::make_shared<spdlog::sinks::stderr_color_sink_mt>());
+		tik::Log::GetCoreLogger()->set_pattern("%^[%l] %v%$");
+	}
+
 	LOG_CORE_WARNING("Note: The results shown in this report are for informational purposes only, and should not be used as a certification or validation of compliance with any legal, regulatory or other requirements.");
 	
 	LOG_CORE_TRACE("Executing in {0}", std::filesystem::current_path().string());
 
-	std::cout << cv::getBuildInformation() << std::endl;
+	//OpenCV build information is only useful when diagnosing backend issues
+	if (cmdOptionExists(argv, argv + argc, "--build-info"))
+	{
+		std::cout << cv::getBuildInformation() << std::endl;
+	}
 
 	bool async = cmdOptionExists(argv, argv + argc, "-a");
+	bool force = cmdOptionExists(argv, argv + argc, "--force"); //reanalyse folders even if their results are up to date
+
+	char* ringName = getCmdOption(argv, argv + argc, "--shm"); //live frames from a capture process instead of a file
+	char* sequenceOrder = getCmdOption(argv, argv + argc, "--sequence"); //a folder is one image sequence instead of a batch of files
 
 	fs::path path;
-	if (argc < 2) 
+	if (ringName) 
+	{
+		path = fs::path(ringName);
+	}
+	else if (streamSource)
+	{
+		path = fs::path(streamSource);
+	}
+	else if (argc < 2) 
 	{
 		LOG_CORE_INFO("Usage: \"{} media_path/", argv[0]); 
 		LOG_CORE_INFO("Please, add the path of the file or directory you want to analyse");
@@ -129,16 +260,45 @@ int main(int argc, char* argv[]) {
 		int aws = std::atoi(analysisWaitSeconds);
 		config.setAnalysisWaitSeconds(aws);
 	}
-	
-	fonttik.init(&config);
 
-	if (fs::exists(path) || path.string().rfind("http",0)==0/*begins with http*/ ) {
+	if (ringName) {
+		fonttik.init(&config);
+		if (!processSharedMemory(fonttik, ringName, async)) {
+			LOG_CORE_ERROR("Shared memory ring \"{0}\" could not be analysed", ringName);
+			return 1;
+		}
+	}
+	else if (streamSource) {
+		fonttik.init(&config);
+		std::ofstream ndjsonFile;
+		if (ndjsonPath) {
+			ndjsonFile.open(ndjsonPath);
+		}
+
+		if (!processStream(fonttik, streamSource, getStreamFormat(argv, argv + argc), ndjsonPath ? ndjsonFile : std::cout)) {
+			LOG_CORE_ERROR("Stream \"{0}\" could not be analysed", streamSource);
+			return 1;
+		}
+	}
+	else if ((fs::is_directory(path) && sequenceOrder) || (!fs::exists(path) && tik::ImageSequence::isPattern(path.string()))) {
+		fonttik.init(&config);
+		if (!processSequence(fonttik, path, sequenceOrder, getCmdOption(argv, argv + argc, "--fps"), async)) {
+			LOG_CORE_ERROR("Image sequence \"{0}\" could not be analysed", path.string());
+			return 1;
+		}
+	}
+	else if (fs::exists(path) || path.string().rfind("http",0)==0/*begins with http*/ ) {
 
 		if (!fs::is_directory(path)) {
+			fonttik.init(&config);
 			processMedia(fonttik, path, config, async);
 		}
 		else {
-			processFolder(fonttik, path, config, async);
+			//Folders are analysed by a pool of workers, each with its own Fonttik
+			tik::BatchScheduler scheduler(config);
+			scheduler.setAsync(async);
+			scheduler.addFolder(path, force);
+			scheduler.run();
 		}
 	}
 	else {
@@ -0,0 +1,82 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+//Reference capture process for live analysis, publishes the frames of a video or image to a shared frame ring at a fixed rate.
+//Run FonttikApp with --shm <name> to analyse them.
+
+#include "fonttik/SharedFrameRing.hpp"
+#include "fonttik/Log.h"
+#include <opencv2/opencv.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+	tik::Log::InitCoreLogger(true, false, 1, nullptr, "%^[%l] %v%$");
+
+	if (argc < 3)
+	{
+		LOG_CORE_INFO("Usage: {} ring_name media_path [fps] [slots] [--loop]", argv[0]);
+		return 1;
+	}
+
+	const std::string name = argv[1];
+	const std::string mediaPath = argv[2];
+	const double fps = (argc > 3) ? std::atof(argv[3]) : 30.0;
+	const int slots = (argc > 4) ? std::atoi(argv[4]) : 4;
+	const bool loop = std::string(argv[argc - 1]) == "--loop";
+
+	//Images are published over and over as a static video
+	cv::Mat image = cv::imread(mediaPath, cv::IMREAD_COLOR);
+	cv::VideoCapture video;
+	if (image.empty() && !video.open(mediaPath))
+	{
+		LOG_CORE_ERROR("{} can't be opened as image or video", mediaPath);
+		return 1;
+	}
+
+	cv::Mat frame = image;
+	if (frame.empty() && !video.read(frame))
+	{
+		LOG_CORE_ERROR("{} has no frames", mediaPath);
+		return 1;
+	}
+
+	std::unique_ptr<tik::SharedFrameRing> ring = tik::SharedFrameRing::create(name, frame.cols, frame.rows, tik::PixelFormat::BGR, slots);
+	if (ring == nullptr)
+	{
+		return 1;
+	}
+	LOG_CORE_INFO("Publishing {} to {} at {} fps", mediaPath, name, fps);
+
+	const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / fps));
+	auto next = std::chrono::steady_clock::now();
+	int frameIndex = 0;
+	while (!frame.empty())
+	{
+		ring->publish(frame.data, frame.step, frameIndex, static_cast<int>(1000.0 * frameIndex / fps));
+		frameIndex++;
+
+		next += interval;
+		std::this_thread::sleep_until(next);
+
+		if (!image.empty())
+		{
+			if (!loop)
+			{
+				frame.release();
+			}
+		}
+		else if (!video.read(frame) && loop)
+		{
+			video.set(cv::CAP_PROP_POS_FRAMES, 0);
+			video.read(frame);
+		}
+	}
+
+	LOG_CORE_INFO("Published {} frames", frameIndex);
+	ring->close();
+	return 0;
+}
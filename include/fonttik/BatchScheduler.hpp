@@ -0,0 +1,116 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "Configuration.hpp"
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace tik
+{
+
+class Fonttik;
+
+/// <summary>
+/// Analyses many media files concurrently with a pool of workers. Each worker owns its Fonttik instance and inference context,
+/// so workers never share a network, while all of them share the configuration. Jobs are dealt to per-worker queues and idle workers steal from the others,
+/// so screenshots keep every core busy while long videos run. Results are always written to the output path of each media file
+/// no matter which worker analysed it.
+/// </summary>
+class BatchScheduler
+{
+public:
+	struct Progress
+	{
+		fs::path media; //media that just finished
+		bool succeeded = false;
+		size_t completed = 0; //finished jobs so far, including failed ones
+		size_t failed = 0;
+		size_t total = 0;
+	};
+
+	using ProgressCallback = std::function<void(const Progress&)>;
+
+	/// <param name="workers">Number of workers, 0 uses the batchWorkers setting and the whole thread budget if that is 0 too.
+	/// Fewer workers run if other pools hold part of the budget.</param>
+	BatchScheduler(const Configuration& configuration, int workers = 0);
+
+	/// <summary>
+	/// Called from the worker threads every time a job finishes, calls are serialized. Logs the progress by default.
+	/// </summary>
+	void setProgressCallback(ProgressCallback callback) { progressCallback = callback; }
+
+	/// <summary>
+	/// Stores the results of each file as its analysis runs, as Fonttik::processMediaAsync does. Videos aren't split into segments then.
+	/// </summary>
+	void setAsync(bool enabled) { async = enabled; }
+
+	/// <summary>
+	/// Queues a media file. Its near duplicates, if any, get a copy of its results once it has been analysed.
+	/// </summary>
+	void add(const fs::path& media, const std::vector<fs::path>& duplicates = {});
+
+	/// <summary>
+	/// Recursively queues every file in folder except for output folders. Files whose results are up to date according to their
+	/// manifest are skipped unless forced, near-duplicate images are grouped when deduplicateImages is enabled.
+	/// </summary>
+	void addFolder(const fs::path& folder, bool force = false);
+
+	/// <summary>
+	/// Analyses every queued job and blocks until all of them are done
+	/// </summary>
+	/// <returns>Number of jobs that were analysed successfully</returns>
+	size_t run();
+
+	//Workers requested, run may get fewer from the thread budget
+	int getWorkerCount() const { return workerCount; }
+
+private:
+	struct Job
+	{
+		fs::path media;
+		std::vector<fs::path> duplicates;
+		bool isVideo = false;
+		uintmax_t size = 0;
+	};
+
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	void work(size_t worker);
+
+	/// <summary>
+	/// Takes the next job of the worker's own queue or steals the last one of another worker
+	/// </summary>
+	bool takeJob(size_t worker, Job& job);
+
+	/// <summary>
+	/// Analyses the media of a job, stores its results and manifest and copies them to its duplicates
+	/// </summary>
+	bool processJob(Fonttik& fonttik, const Job& job);
+
+	void reportProgress(const Job& job, bool succeeded);
+
+	Configuration configuration;
+	uint64_t configurationHash;
+	int workerCount;
+	std::vector<Job> pending;
+	std::vector<std::unique_ptr<WorkerQueue>> queues;
+	ProgressCallback progressCallback;
+	bool async = false;
+
+	std::mutex progressMutex;
+	size_t completed = 0;
+	size_t failed = 0;
+	size_t total = 0;
+};
+
+}
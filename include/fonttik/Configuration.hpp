@@ -29,6 +29,7 @@ public:
 	inline const DetectionBackend& getTextDetectionBackend() const { return textDetectionBackend; }
 	inline const ContrastRatioParams& getContrastRatioParams() const { return contrastRatioParams; }
 	inline const TextSizeParams& getTextSizeParams() const { return textSizeParams; }
+	inline const PerformanceParams& getPerformanceParams() const { return performanceParams; }
 	inline const std::vector<double>& getSbgrValues() const { return sBgrValues; }
 	inline const cv::Mat& getLinearRGBToLMSMatrix() const { return linearRGBToLMSMatrix; }
 	inline const cv::Mat& getXYZJuddVosToLMSMatrix() const { return XYZJuddVosToLMSMatrix; }
@@ -37,9 +38,24 @@ public:
 	inline const cv::Mat& getDeutanProjectionMatrix() const { return deutanProjectionMatrix; }
 	const std::vector<cv::Scalar> getOutlineColors() const { return outlineColors; }
 
+	/// <summary>
+	/// Hashes of the detection and recognition settings as loaded, results produced with equal hashes are interchangeable
+	/// </summary>
+	inline uint64_t getDetectionHash() const { return detectionHash; }
+	inline uint64_t getRecognitionHash() const { return recognitionHash; }
+
+	/// <summary>
+	/// Hash of the whole configuration: the file as loaded plus the settings that can be changed at runtime
+	/// </summary>
+	uint64_t getHash() const;
+
 	inline void setAnalysisWaitSeconds(const int& aws) { appSettings.analysisWaitSeconds = aws; }
 	bool setResolutionGuideline(const std::string& imgWidth);
 	/// <summary>
+	/// Returns the size guideline of a resolution without changing the configuration, nullptr if there is none
+	/// </summary>
+	const SizeGuidelines* findResolutionGuideline(const std::string& resolutionKey) const;
+	/// <summary>
 	/// Disables automatic resolution detection and sets a target resolution to use the guidelines
 	/// </summary>
 	/// <param name="v"></param>
@@ -56,6 +72,8 @@ public:
 		maskParams.ignoreMasks = ignoreMasks;
 	}
 	inline void setUseOcr(const bool useOcr) { textSizeParams.useTextRecognition = useOcr; }
+	inline void setUseColorblindFilters(const bool useColorblindFilters) { appSettings.useColorblindFilters = useColorblindFilters; }
+	inline void setPerformanceParams(const PerformanceParams& pp) { performanceParams = pp; }
 	inline void setTreatFailsAsWarnings(const bool failsAsWarnings) { appSettings.failsAsWarnings = failsAsWarnings; }
 	inline void setContrastRatio(const float cr) { contrastRatioParams.contrastRatio = cr; }
 	inline void setSizeGuideline(const std::string& height, const SizeGuidelines& sg) { textSizeParams.resolutionGuidelines[height] = sg; }
@@ -74,6 +92,7 @@ private:
 	void loadTextSizeParams(const json& section, const json& section2);
 	void loadEASTParams(const json& section);
 	void loadDiffBinarizationParams(const json& section);
+	void loadPerformanceParams(const json& section);
 	cv::Mat loadMatrix(const json& section);
 	std::unordered_map<std::string, SizeGuidelines> loadSizeGuidelines(const json& section);
 
@@ -93,6 +112,7 @@ private:
 	TextRecognitionParams textRecognitionParams;
 	ContrastRatioParams contrastRatioParams;
 	TextSizeParams textSizeParams;
+	PerformanceParams performanceParams;
 
 	cv::Mat linearRGBToXYZJuddVosMatrix;
 	cv::Mat XYZJuddVosToLMSMatrix;
@@ -102,6 +122,9 @@ private:
 	cv::Mat deutanProjectionMatrix;
 	std::vector<double> sBgrValues;
 	std::vector<cv::Scalar> outlineColors;
+	uint64_t detectionHash = 0;
+	uint64_t recognitionHash = 0;
+	uint64_t fileHash = 0;
 };
 
 }
\ No newline at end of file
@@ -22,6 +22,7 @@ struct AppSettings
 	int analysisWaitSeconds;
 	bool detectResolution;
 	bool sizeByLine;
+	bool useColorblindFilters = true; //Colorblind filters are only created when enabled
 };
 
 struct MaskParams
@@ -46,8 +47,8 @@ struct TextSizeParams
 	std::unordered_map<std::string, SizeGuidelines> resolutionGuidelines;
 	std::unordered_map<std::string, SizeGuidelines> resolutionRecommendations;
 	std::unordered_map<std::string, SizeGuidelines> dpiGuidelines;
-	SizeGuidelines* activeGuideline = nullptr;
-	SizeGuidelines* activeRecommendation = nullptr;
+	const SizeGuidelines* activeGuideline = nullptr; //only set by Configuration::setResolutionGuideline, analysis resolves its guideline per media
+	const SizeGuidelines* activeRecommendation = nullptr;
 
 };
 
@@ -64,6 +65,10 @@ struct EASTDetectionParams
 	float nonMaxSuprresionThreshold; //Non maximum supresison threshold
 	double detectionScale; //Scales pixel individually after mean substraction
 	std::array<double, 3> detectionMean;//This values will be substracted from the corresponding channel
+	bool customDecode = false; //Runs the raw network and decodes its outputs with Fonttik's own decode and NMS instead of OpenCV's
+	bool refineHighResolution = false; //Detects on a downscaled copy of high resolution frames and refines the candidates at native resolution
+	int refineDetectionHeight = 1080; //Frames taller than this are downscaled to it for the candidate pass
+	int refinePadding = 32; //Pixels added around each candidate, on top of its own height, before refining it
 };
 
 struct DBDetectionParams
@@ -75,7 +80,10 @@ struct DBDetectionParams
 	double unclipRatio = 2.0; //Equivalent to non max suppression
 	float scale = 1.0 / 255;
 	std::array<double, 3> mean = { 123.68, 116.78, 103.94 };//This values will be substracted from the corresponding channel
-	std::array<int, 2> inputSize = { 736,736 };//This values will be substracted from the corresponding channel
+	std::array<int, 2> inputSize = { 736,736 };//Network input size when the aspect ratio isn't preserved
+	bool preserveAspectRatio = true; //Picks the input size per frame keeping the frame's aspect ratio, instead of squashing it into inputSize
+	int maxInputPixels = 736 * 736; //Pixel budget for aspect ratio preserving input sizes
+	int inputStride = 32; //Input sizes are rounded down to a multiple of the model stride
 };
 
 struct TextDetectionParams
@@ -101,6 +109,46 @@ struct TextDetectionParams
 	PreferredTarget preferredTarget = PreferredTarget::CPU;
 	EASTDetectionParams eastParams;
 	DBDetectionParams dbParams;
+	int inputCacheSize = 8; //EAST input sizes whose buffers are kept, the network and its weights are shared by all of them
+};
+
+struct PerformanceParams
+{
+	bool parallelModelLoading = true; //Loads the detection and recognition models concurrently
+	bool warmUpModels = true; //Runs a dummy inference during init so the first frame doesn't pay for backend allocations
+	std::array<int, 2> warmUpResolution = { 1920, 1080 }; //Expected media resolution used for the warm-up pass
+	bool textPrefilter = false; //Skips detection on frames a cheap edge density check finds no text in
+	float prefilterThreshold = 0.02; //Minimum edge density a tile needs to be considered as possibly containing text
+	std::array<int, 2> prefilterGrid = { 8, 6 }; //Tile columns and rows the frame is split in
+	int prefilterWidth = 480; //Frames are downsampled to this width before scoring
+	bool autoCropBorders = false; //Crops uniform dark borders (letterboxing) away from frames before analysis
+	int borderThreshold = 16; //Maximum gray level of a border pixel
+	bool hudLayout = false; //Learns where text appears in videos and only detects there between periodic full scans
+	int hudLearningFrames = 10; //Analysed frames scanned whole before restricting detection
+	int hudRescanInterval = 30; //Analysed frames between full scans once the layout is learned
+	float hudMinHitRatio = 0.1; //Share of full scans a location needs text in to be part of the layout
+	int hudRegionMargin = 16; //Pixels added around each HUD region
+	int hudMaxRegions = 4; //Closest regions are merged until there are at most this many
+	bool incrementalAnalysis = false; //Only analyses the regions that changed since the previous analysed frame, carrying over the other results
+	int incrementalTileSize = 64; //Frames are compared on tiles of this size
+	int incrementalMargin = 32; //Pixels added around changed tiles
+	int incrementalPixelThreshold = 12; //Gray level difference for a pixel to count as changed
+	float incrementalMaxChangedArea = 0.5; //Frames with more changed area than this are analysed whole
+	bool boxTracking = false; //Tracks boxes across analysed frames and reuses the results of the ones that didn't change
+	float trackingMinIoU = 0.5; //Minimum overlap with a box of the previous frame to continue its track
+	bool boxCache = false; //Caches box results by their pixels so identical boxes in any frame or media aren't checked again
+	int boxCacheMemoryMB = 64; //Memory budget of the box cache
+	bool detectionCache = false; //Keeps detections and recognized text in a file so reruns with other checker settings skip inference
+	std::string detectionCachePath = "detectionCache.bin"; //File of the detection cache, shared by every run using it
+	bool deduplicateImages = false; //Folder analysis only analyses one image per group of near duplicates
+	int duplicateMaxDistance = 4; //Maximum perceptual hash bits two images can differ in to be near duplicates
+	bool lazyTextRecognition = false; //Only recognizes the text of boxes under the size guideline, the rest are reported without text
+	int batchWorkers = 0; //Media files analysed at the same time in folder analysis, 0 uses the whole thread budget
+	int videoSegments = 1; //Segments each video is split into and analysed concurrently, 0 uses the whole thread budget
+	int threadBudget = 0; //Threads Fonttik and OpenCV may keep busy in the whole process, 0 uses one per core
+	bool pinThreads = false; //Pins worker and segment threads to consecutive cores
+	double frameBudgetMs = 0; //Real-time mode analysis time per frame, stages are degraded and frames dropped to keep up. 0 disables it
+	float realTimeDetectionScale = 0.5; //Detection input scale when real-time mode coarsens detection
 };
 
 struct TextRecognitionParams
@@ -0,0 +1,67 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <opencv2/core.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace tik
+{
+
+/// <summary>
+/// Groups near-duplicate images (the same menu captured repeatedly, burst captures) by their perceptual hash,
+/// so only one image per group has to be analysed.
+/// </summary>
+class DuplicateFinder
+{
+public:
+	struct ImageHash
+	{
+		uint64_t hash = 0;
+		cv::Size size; //empty if the file couldn't be read as an image
+	};
+
+	struct Cluster
+	{
+		fs::path representative; //the image to analyse
+		std::vector<fs::path> duplicates; //images whose results are taken from the representative
+	};
+
+	/// <param name="maxDistance">Maximum number of differing hash bits for two images to be duplicates</param>
+	/// <param name="threads">Threads used to read and hash images, 0 uses the whole thread budget</param>
+	DuplicateFinder(int maxDistance, int threads = 0);
+
+	/// <summary>
+	/// Hashes the files in parallel and groups them. Every file ends up in exactly one cluster, files that aren't images
+	/// are clusters of their own. Representatives are the first file of each cluster in the given order.
+	/// </summary>
+	std::vector<Cluster> cluster(const std::vector<fs::path>& files) const;
+
+	/// <summary>
+	/// 64 bit DCT perceptual hash, robust to compression, small color shifts and rescaling
+	/// </summary>
+	static uint64_t perceptualHash(const cv::Mat& image);
+
+	static int distance(uint64_t a, uint64_t b);
+
+	/// <summary>
+	/// Groups hashes in order, each one joins the first group whose first member is close enough and has the same size
+	/// </summary>
+	/// <returns>Indices of the members of each group, the first one being its representative</returns>
+	static std::vector<std::vector<size_t>> groupHashes(const std::vector<ImageHash>& hashes, int maxDistance);
+
+	/// <summary>
+	/// Writes the JSON results of the representative into the output path of a duplicate, marking every frame as deduplicated
+	/// </summary>
+	static bool copyResults(const fs::path& representativeOutput, const fs::path& duplicateOutput, const std::string& representativeName);
+
+private:
+	int maxDistance;
+	int threads;
+};
+
+}
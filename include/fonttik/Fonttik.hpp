@@ -1,10 +1,15 @@
 //Copyright (C) 2022-2025 Electronic Arts, Inc.  All rights reserved.
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <iosfwd>
+#include <memory>
 #include <opencv2/core/mat.hpp>
 namespace fs = std::filesystem;
 #include "Results.h"
+#include "Metrics.hpp"
 #include "../src/ColorblindFilters.hpp"
 
 namespace tik
@@ -12,14 +17,22 @@ namespace tik
 
 class Configuration;
 class Media;
+class Video;
 class Results;
 class Frame;
 class ITextboxDetection;
 class ITextBoxRecognition;
 class IChecker;
+class SizeChecker;
+class TextPrefilter;
+class BoxCache;
+class DetectionCache;
+struct AnalysisContext;
 class TextBox;
 struct FrameResults;
+struct SizeGuidelines;
 
+//Outputs of processMediaAsync, paths of outputs the media didn't write are empty
 struct AsyncResults 
 {
 	fs::path pathToSizeResult;
@@ -42,31 +55,114 @@ struct AsyncResults
 
 
 
+/// <summary>
+/// Analyses media for text size and contrast.
+/// An instance analyses one media at a time, media are analysed concurrently with one instance per thread. Instances only read
+/// their Configuration, one configuration can be shared by any number of them as long as it isn't modified while they analyse.
+/// Everything that depends on the media (resolution guideline, skip interval, masks) is kept per analysis. Each instance gets its
+/// own networks and keeps them whichever thread runs it. Every network holds its own copy of the model weights.
+/// </summary>
 class Fonttik
 {
 public:
 	Fonttik() {};
-	Fonttik(Configuration* config) { init(config); };
+	Fonttik(const Configuration* config) { init(config); };
 	~Fonttik();
 
-	void init(Configuration* config);
+	void init(const Configuration* config);
 
 	AsyncResults processMediaAsync(Media& media);
 
 	Results processMedia(Media& media);
 
+	/// <summary>
+	/// Analyses a frame. In real-time mode stages are degraded as needed to stay within the frame budget, and the results record which
+	/// </summary>
 	std::pair<FrameResults, FrameResults> processFrame(Frame& frame, std::vector<Frame> colorblindFrames, bool sizeByLine);
+
+	/// <summary>
+	/// Starts analysing a media frame by frame, e.g. a MemoryMedia fed by a capture loop. The per media state is kept
+	/// across its frames until the next media begins.
+	/// </summary>
+	/// <returns>False if the media resolution is not supported</returns>
+	bool beginMedia(Media& media);
+
+	/// <summary>
+	/// Analyses the frame currently loaded in media, beginMedia must have been called for it
+	/// </summary>
+	std::pair<FrameResults, FrameResults> processFrame(Media& media);
 	
 	std::pair<fs::path, fs::path> saveResults(Media& media, Results& results);
 
 	std::pair<fs::path, fs::path> saveResultsToJson(fs::path outputPath, Results& results);
 
+	/// <summary>
+	/// Writes the size and contrast results of a frame as one JSON line, for streaming results as NDJSON while a media is analysed
+	/// </summary>
+	void writeResultsLine(std::ostream& out, const std::pair<FrameResults, FrameResults>& results);
+
+	/// <summary>
+	/// Returns the colorblind filters, creating them on first use. Returns nullptr if they are disabled in the configuration
+	/// </summary>
+	ColorblindFilters* getColorblindFilters();
+
+	/// <summary>
+	/// Returns the runtime counters gathered since init
+	/// </summary>
+	Metrics getMetrics() const;
+
 	ColorblindFilters* colorblindFilters = nullptr;
 
 private:
-	bool setResolutionGuideline(const Media& media);
+	/// <summary>
+	/// Creates the text recognition model if OCR has been enabled after init
+	/// </summary>
+	void initTextRecognition();
+
+	/// <summary>
+	/// Replaces the per media state with a fresh one, called when a media analysis starts
+	/// </summary>
+	void beginAnalysis(const SizeGuidelines& guideline);
+
+	/// <summary>
+	/// Analyses a frame, real-time mode times it from started on
+	/// </summary>
+	std::pair<FrameResults, FrameResults> processFrame(Frame& frame, std::vector<Frame> colorblindFrames, bool sizeByLine,
+		std::chrono::steady_clock::time_point started);
+
+	/// <summary>
+	/// Returns the colorblind frames of the loaded frame, or none without filtering when real-time mode is going to skip them
+	/// </summary>
+	std::vector<Frame> loadColorblindFrames(Media& media);
+
+	/// <summary>
+	/// Analyses a frame with the stages processFrame set up, degraded or not
+	/// </summary>
+	std::pair<FrameResults, FrameResults> analyseFrame(Frame& frame, std::vector<Frame> colorblindFrames, bool sizeByLine);
 
-	bool checkResolution(const cv::Size& mediaSize, const cv::Size& resolution);
+	/// <summary>
+	/// In real-time mode, tells the media how long the analysis has been running so the frames played meanwhile are dropped
+	/// </summary>
+	void keepUpWith(Media& media);
+
+	/// <summary>
+	/// Returns the size guideline matching the media resolution, or the target resolution if detection is disabled. nullptr if unsupported
+	/// </summary>
+	const SizeGuidelines* findResolutionGuideline(const Media& media) const;
+
+	/// <summary>
+	/// Number of segments a video is split into by the videoSegments setting, 1 if it is too short to be worth splitting
+	/// </summary>
+	int getVideoSegmentCount(Video& video);
+
+	/// <summary>
+	/// Splits a video into segments analysed concurrently, each with its own decoder and Fonttik, and merges their results in order.
+	/// Frames are the ones a sequential run analyses: where a segment's selection differs from it at its start, the sequential
+	/// selection is analysed instead until both meet.
+	/// </summary>
+	Results processVideoSegments(Video& video, int segments);
+
+	bool checkResolution(const cv::Size& mediaSize, const cv::Size& resolution) const;
 
 	void calculateTextBoxLuminance(std::vector<TextBox>& textBoxes);
 
@@ -79,11 +175,24 @@ private:
 	/// </summary>
 	void setTextInContrastResults(const FrameResults& sizeResults, FrameResults& contrastResults);
 
-	Configuration* configuration = nullptr;
+	/// <summary>
+	/// Moves results found in a cropped region of the frame back to frame coordinates
+	/// </summary>
+	void offsetResults(FrameResults& results, const cv::Point& offset);
+
+	const Configuration* configuration = nullptr;
 	ITextboxDetection* textBoxDetection = nullptr;
 	ITextBoxRecognition* textBoxRecognition = nullptr;
 	IChecker* contrastChecker = nullptr;
-	IChecker* sizeChecker = nullptr;
+	SizeChecker* sizeChecker = nullptr;
+	TextPrefilter* textPrefilter = nullptr;
+	BoxCache* boxCache = nullptr;
+	std::shared_ptr<DetectionCache> detectionCache; //shared with every Fonttik using the same cache file
+	AnalysisContext* analysisContext = nullptr;
+	std::vector<std::unique_ptr<Fonttik>> segmentFonttiks; //analyse video segments, kept between videos
+	InitStats initStats;
+	uint64_t inferenceContext = 0; //ModelRegistry context of this instance's networks, whichever thread runs it
+	const int MIN_SEGMENT_FRAMES = 600; //Videos are only split into segments of at least this many frames
 	const int MAX_LEEWAY = 100; //Maximum leeway for the resolution when detecting the media resolution
 	const cv::Size RESOLUTION_1080p = cv::Size(1920, 1080);
 	const cv::Size RESOLUTION_720p = cv::Size(1280, 720);
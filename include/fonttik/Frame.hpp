@@ -24,6 +24,13 @@ public:
 	void applyMask(cv::Mat mask);
 
 	cv::Mat getFrameMat() { return image; }
+
+	//Region of the frame without letterbox borders, the whole frame if none were found
+	cv::Mat getContentMat() { return contentRect.empty() ? image : image(contentRect); }
+
+	inline cv::Point getContentOffset() const { return contentRect.tl(); }
+
+	void setContentRect(const cv::Rect& rect) { contentRect = rect; }
 		
 	inline int getFrameIndex() { return frameIndex; }
 
@@ -43,6 +50,7 @@ private:
 	//apply mask info
 
 	cv::Mat image;
+	cv::Rect contentRect; //empty means the whole frame
 	int frameIndex;
 	std::string timeStamp;
 };
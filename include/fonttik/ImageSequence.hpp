@@ -0,0 +1,100 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/Media.hpp"
+#include <memory>
+
+namespace tik
+{
+
+//Order the images of a folder are played in
+enum class SequenceOrder
+{
+	Natural, //numbers in file names compare by value, frame_9 comes before frame_10
+	Name,
+	ModifiedTime
+};
+
+/// <summary>
+/// Numbered images, such as the PNG or JPEG frames capture tools write, analysed as the frames of a video. Frames are skipped by
+/// AnalysisWaitSeconds, similarity to the last analysed frame and real-time mode the same way video frames are, and the outputs are
+/// the same as a video's. A few threads leased from the ThreadBudget decode the frames the analysis will ask for next into a bounded
+/// buffer, skipped frames are never decoded. Outputs are stored next to the folder of the images.
+/// </summary>
+class ImageSequence : public Media
+{
+public:
+	static constexpr double DEFAULT_FPS = 30;
+	static constexpr int DEFAULT_PREFETCH = 8;
+
+	/// <summary>
+	/// Creates a sequence from a printf-style pattern with one integer field, e.g. shots/frame_%05d.png. Every file in the folder
+	/// of the pattern that matches it is a frame, in the order of their numbers. Gaps in the numbering are skipped.
+	/// </summary>
+	/// <returns>nullptr if no file matches or the first one isn't an image</returns>
+	static ImageSequence* fromPattern(const std::string& pattern, double fps = DEFAULT_FPS, int prefetch = DEFAULT_PREFETCH);
+
+	/// <summary>
+	/// Creates a sequence from every image in a folder
+	/// </summary>
+	/// <returns>nullptr if the folder has no images</returns>
+	static ImageSequence* fromDirectory(const fs::path& directory, SequenceOrder order = SequenceOrder::Natural, double fps = DEFAULT_FPS,
+		int prefetch = DEFAULT_PREFETCH);
+
+	//True if path is a printf-style pattern rather than a file name
+	static bool isPattern(const std::string& path);
+
+	//Files matching a pattern in the order of their numbers
+	static std::vector<fs::path> findPatternFrames(const std::string& pattern);
+
+	//Images of a folder in the given order
+	static std::vector<fs::path> findDirectoryFrames(const fs::path& directory, SequenceOrder order);
+
+	/// <param name="name">Media source, outputs are stored next to it</param>
+	/// <param name="frames">Image files in playback order, all of the same size</param>
+	/// <param name="prefetch">Maximum frames decoded ahead of the analysis</param>
+	ImageSequence(std::string name, std::vector<fs::path> frames, double fps = DEFAULT_FPS, int prefetch = DEFAULT_PREFETCH);
+	virtual ~ImageSequence();
+
+	ImageSequence(const ImageSequence&) = delete;
+	ImageSequence& operator=(const ImageSequence&) = delete;
+
+	virtual bool loadFrame() override;
+
+	virtual Frame getFrame() override;
+	virtual std::vector<Frame> getColorblindFrames() override { return {}; }
+
+	virtual std::pair<fs::path, fs::path> saveResultsOutlines(const SaveResultProperties& sizeResultProperties,
+		const SaveResultProperties& contrastResultProperties) override;
+
+	virtual void saveResultsOutlinesAsync(const SaveResultProperties& sizeResultProperties,
+		const SaveResultProperties& contrastResultProperties, rigtorp::SPSCQueue<FrameResult>& queue, std::atomic<bool>& done) override;
+
+	virtual std::string getExtension() override { return ".mp4"; }
+
+	virtual void setAnalysisWaitSeconds(int aws) override;
+	virtual void setPlaybackPosition(int msSinceStart) override;
+
+	int getFrameCount() const { return static_cast<int>(frames.size()); }
+	double getFps() const { return fps; }
+	const std::vector<fs::path>& getFrames() const { return frames; }
+
+private:
+	class Decoder;
+
+	//Loads the frame at index, or the first readable one after it. step is the distance to the frames the analysis will ask for next
+	bool loadFrameFrom(int index, int step);
+
+	std::vector<fs::path> frames;
+	double fps;
+	int prefetch;
+	std::unique_ptr<Decoder> decoder; //started on the first loaded frame
+
+	cv::Mat currentFrame;
+	cv::Mat previousFrame;
+	int msTimeStamp = 0;
+	int framesToSkip = 0;
+	int playbackFrame = 0; //real-time mode, frames before this one are dropped
+};
+
+}
@@ -26,6 +26,7 @@ struct FrameResult
 	FrameResults contrast;
 	int frameID;
 	std::string timeStamp = "";
+	cv::Mat frame; //copy of the analysed frame, only set for media whose frames don't outlive their analysis
 };
 class Media
 {
@@ -41,7 +42,7 @@ public:
 
 	virtual ~Media() {};
 
-	//Factory Method that creates a video or an image depending on the file
+	//Factory Method that creates a video, an image or an image sequence (from a printf-style pattern) depending on the file
 	//returns nullptr in case of invalid file
 	static Media* createMedia(std::string mediaSource, ColorblindFilters* colorblindFilters=nullptr);
 
@@ -59,6 +60,9 @@ public:
 	virtual Frame getFrame() = 0;
 	virtual std::vector<Frame> getColorblindFrames() = 0;
 
+	//True if getColorblindFrames returns filtered frames, real-time mode has nothing to gain from skipping them otherwise
+	virtual bool producesColorblindFrames() const { return false; }
+
 	fs::path getPath() {
 		return fs::path{mediaSource};
 	};
@@ -70,6 +74,12 @@ public:
 	virtual void saveResultsOutlinesAsync(const SaveResultProperties& sizeResultProperties, const SaveResultProperties& contrastResultProperties,
 		rigtorp::SPSCQueue<FrameResult>& queue, std::atomic<bool>& done) = 0;
 
+	/// <summary>
+	/// False for media whose frames are replaced or freed when the next one is loaded, e.g. frames owned by the caller.
+	/// Asynchronous outlines of their frames are drawn on a copy queued with the results.
+	/// </summary>
+	virtual bool framesOutliveAnalysis() const { return true; }
+
 
 	//Saves the data in the image sub folder
 	void saveOutputData(cv::Mat data, fs::path path);
@@ -77,19 +87,52 @@ public:
 	//Returns output path and if it doesn't exist creates it
 	fs::path getOutputPath();
 
+	//Returns the output path results of mediaSource are stored in, without creating it
+	static fs::path getOutputPath(const std::string& mediaSource);
+
 	virtual std::string getExtension() = 0;
 
 	virtual void setAnalysisWaitSeconds(int aws) {};
 
+	/// <summary>
+	/// Used by real-time mode to keep up with the media, frames that would have been shown before the given time since the first
+	/// loaded frame are not loaded. Live media always load their newest frame and ignore it.
+	/// </summary>
+	virtual void setPlaybackPosition(int msSinceStart) {};
+
+	/// <summary>
+	/// Enables cropping uniform dark borders (letterboxing, pillarboxing) away from the frames before analysis
+	/// </summary>
+	/// <param name="threshold">Maximum gray level a pixel can have to be considered part of a border</param>
+	void setAutoCrop(bool enabled, int threshold) { autoCrop = enabled; borderThreshold = threshold; contentRect = {}; }
+
+	/// <summary>
+	/// Returns the region of frame inside its uniform dark borders. Returns an empty rect if the whole frame is dark
+	/// </summary>
+	static cv::Rect findContentRect(const cv::Mat& frame, int threshold);
+
 	const cv::Size& getImageSize() const { return imageSize; }
 
 protected:
 
 	Media(std::string mediaPath) : mediaSource{mediaPath}, frameIndex{ 0 } {}
+
+	/// <summary>
+	/// Keeps the content rect up to date with the given frame. Borders are only searched again
+	/// when the frame no longer has them, e.g. after a scene change
+	/// </summary>
+	void updateContentRect(const cv::Mat& frame);
+
+	//Returns true if every pixel of frame outside of content is under the border threshold
+	bool bordersAreUniform(const cv::Mat& frame, const cv::Rect& content) const;
 	
 	cv::Mat mask; //result of the calculation of the focus and ignore masks
 	cv::Size imageSize; //video frame or image size
 
+	bool autoCrop = false;
+	int borderThreshold = 16;
+	cv::Rect contentRect; //frame region inside the borders, empty while unknown
+
 	std::string mediaSource{};
 
 	int frameIndex; //current frame position 
@@ -0,0 +1,102 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/Media.hpp"
+#include <cstdint>
+
+namespace tik
+{
+
+enum class PixelFormat
+{
+	BGR,
+	BGRA,
+	RGBA
+};
+
+/// <summary>
+/// Frame owned by the caller, e.g. a capture or render target readback. Rows can be padded, stride is the distance in bytes between rows.
+/// </summary>
+struct FrameBuffer
+{
+	const uint8_t* data = nullptr;
+	int width = 0;
+	int height = 0;
+	size_t stride = 0; //0 means tightly packed rows
+	PixelFormat format = PixelFormat::BGR;
+	int frameIndex = 0;
+	int msTimeStamp = 0;
+};
+
+/// <summary>
+/// Media fed with frames that are already in memory, for embedding Fonttik in capture tools without encoding frames to disk.
+/// BGR buffers are analysed in place, BGRA and RGBA ones are converted to BGR once since the analysis works on 3 channels.
+/// Buffers are never copied or freed by the media, the caller keeps them alive until the frame has been processed.
+/// Frames are analysed one at a time with Fonttik::beginMedia and Fonttik::processFrame(Media&), or all at once with processMedia.
+/// processMediaAsync outlines every frame on a copy taken before the next frame is loaded, to sizeChecks_N.png and
+/// contrastChecks_N.png where N is the frame index, and writes the results of every frame to sizeChecks.json and contrastChecks.json.
+/// </summary>
+class MemoryMedia : public Media
+{
+public:
+	/// <param name="name">Identifies the media in logs and results, results outlines are saved to the default output folder</param>
+	/// <param name="frameSize">Size every pushed frame must have, used to pick the size guideline</param>
+	MemoryMedia(std::string name, cv::Size frameSize, ColorblindFilters* colorblindFilters = nullptr);
+	virtual ~MemoryMedia() = default;
+
+	/// <summary>
+	/// Sets the frame loadFrame will return next, replacing any frame that hasn't been loaded yet
+	/// </summary>
+	/// <returns>False if the buffer is empty or its size doesn't match the media</returns>
+	bool pushFrame(const FrameBuffer& buffer);
+
+	/// <summary>
+	/// Wraps an image that is already a cv::Mat, BGR images aren't copied
+	/// </summary>
+	bool pushFrame(const cv::Mat& image, int frameIndex, int msTimeStamp = 0);
+
+	/// <summary>
+	/// Loads the pushed frame
+	/// </summary>
+	/// <returns>False if no frame was pushed since the last call</returns>
+	virtual bool loadFrame() override;
+
+	virtual Frame getFrame() override;
+	virtual std::vector<Frame> getColorblindFrames() override;
+	virtual bool producesColorblindFrames() const override { return colorblindFilters != nullptr; }
+
+	std::pair<fs::path, fs::path> saveResultsOutlines(const SaveResultProperties& sizeResultProperties,
+		const SaveResultProperties& contrastResultProperties) override;
+
+	void saveResultsOutlinesAsync(const SaveResultProperties& sizeResultProperties,
+		const SaveResultProperties& contrastResultProperties, rigtorp::SPSCQueue<FrameResult>& queue, std::atomic<bool>& done) override;
+
+	virtual std::string getExtension() override { return ".png"; }
+
+	//Pushed frames belong to the caller, asynchronous outlines need a copy
+	virtual bool framesOutliveAnalysis() const override { return false; }
+
+	/// <summary>
+	/// Returns the Mat a buffer is analysed as, a view of the caller's memory for BGR buffers and a converted copy otherwise
+	/// </summary>
+	static cv::Mat wrapBuffer(const FrameBuffer& buffer);
+
+protected:
+	//Forgets the loaded frame once the memory it points at is no longer the caller's to read
+	void releaseFrame() { currentFrame.release(); }
+
+private:
+	fs::path saveResultsOutlines(const cv::Mat& frame, const FrameResults& results, const fs::path& path, const std::vector<cv::Scalar>& colors,
+		bool saveNumbers, bool contrast);
+
+	//Outline path of a single frame, e.g. sizeChecks_12.png
+	static fs::path getFramePath(const fs::path& path, int frameIndex);
+
+	ColorblindFilters* colorblindFilters;
+	cv::Mat pendingFrame, currentFrame;
+	int pendingIndex = 0, pendingTimeStamp = 0;
+	int msTimeStamp = 0;
+	bool hasPendingFrame = false;
+};
+
+}
@@ -0,0 +1,85 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <cstddef>
+
+namespace tik
+{
+
+struct CacheStats
+{
+	size_t hits = 0;
+	size_t misses = 0;
+	size_t evictions = 0;
+
+	double hitRate() const { return (hits + misses) == 0 ? 0.0 : double(hits) / double(hits + misses); }
+};
+
+struct PrefilterStats
+{
+	size_t framesEvaluated = 0;
+	size_t framesSkipped = 0; //Frames where detection didn't run
+	size_t tilesEvaluated = 0;
+	size_t tilesBelowThreshold = 0; //Tiles scored as unlikely to contain text
+};
+
+struct HudLayoutStats
+{
+	size_t fullScans = 0; //Frames detected whole, while learning or rescanning
+	size_t regionScans = 0; //Frames only detected inside the learned HUD regions
+	double regionCoverage = 0; //Average share of the frame covered by the regions on region scans
+};
+
+struct IncrementalStats
+{
+	size_t fullFrames = 0; //Frames analysed whole
+	size_t incrementalFrames = 0; //Frames where only the changed regions were analysed
+	size_t carriedResults = 0; //Result boxes reused from the previous analysed frame
+	double changedArea = 0; //Average share of the frame analysed on incremental frames
+};
+
+struct TrackingStats
+{
+	size_t matchedBoxes = 0; //Boxes that continued a track of the previous analysed frame
+	size_t reusedBoxes = 0; //Matched boxes whose pixels didn't change, their result was reused
+	size_t newTracks = 0;
+};
+
+struct RealTimeStats
+{
+	size_t frames = 0;
+	size_t framesOverBudget = 0; //Frames whose analysis took longer than the frame budget
+	size_t degradedFrames = 0; //Frames analysed with at least one stage degraded
+	double averageMs = 0; //Smoothed analysis time per frame
+};
+
+struct InitStats
+{
+	bool detectionLoaded = false;
+	bool recognitionLoaded = false; //Loaded by init when text recognition is enabled, otherwise once it is first enabled
+	double totalMs = 0;
+	double detectionLoadMs = 0;
+	double detectionWarmUpMs = 0; //0 when warm-up is disabled
+	double recognitionLoadMs = 0;
+	double recognitionWarmUpMs = 0; //0 when warm-up is disabled or recognition wasn't loaded by init
+};
+
+/// <summary>
+/// Runtime counters gathered by a Fonttik instance since it was initialized
+/// </summary>
+struct Metrics
+{
+	InitStats init; //Model loading and warm-up done by init
+	CacheStats detectionInputCache; //Detection input buffers kept allocated per input size
+	PrefilterStats prefilter; //Text presence prefilter, empty when disabled
+	CacheStats boxCache; //Results of boxes seen before, empty when disabled
+	size_t boxCacheMemory = 0; //Bytes used by the box cache
+	CacheStats persistentDetections; //Whole frame detections read from the detection cache file, empty when disabled
+	CacheStats persistentRecognitions; //Recognized texts read from the detection cache file, empty when disabled
+	HudLayoutStats hudLayout; //HUD layout of the last analysed media, empty when disabled
+	IncrementalStats incremental; //Incremental analysis of the last analysed media, empty when disabled
+	TrackingStats tracking; //Box tracking of the last analysed media, empty when disabled
+	RealTimeStats realTime; //Real-time mode of the last analysed media, empty when disabled
+};
+
+}
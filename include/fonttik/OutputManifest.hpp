@@ -0,0 +1,53 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace tik
+{
+
+/// <summary>
+/// Record kept next to the results of a media file describing what produced them: the input file size, modification time and
+/// content hash, the configuration hash and the library version. Reruns over the same folder use it to only analyse new or changed files.
+/// </summary>
+class OutputManifest
+{
+public:
+	static constexpr const char* FILE_NAME = "manifest.json";
+
+	/// <summary>
+	/// Describes input as it would be analysed now. The content hash is only computed when needed.
+	/// </summary>
+	OutputManifest(const fs::path& input, uint64_t configHash);
+
+	/// <summary>
+	/// True if outputPath holds complete results of the same input contents analysed with the same configuration and library version.
+	/// If only the modification time changed the stored manifest is refreshed.
+	/// </summary>
+	bool isUpToDate(const fs::path& outputPath);
+
+	/// <summary>
+	/// Writes the manifest to outputPath, call once its results have been stored
+	/// </summary>
+	void save(const fs::path& outputPath);
+
+	static std::string getLibraryVersion();
+
+private:
+	uint64_t getContentHash();
+
+	static std::string toHex(uint64_t value);
+
+	fs::path input;
+	uintmax_t size = 0;
+	int64_t modificationTime = 0;
+	uint64_t configHash;
+	uint64_t contentHash = 0;
+	bool hasContentHash = false;
+};
+
+}
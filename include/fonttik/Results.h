@@ -20,6 +20,17 @@ enum ResultType
 ResultType ResultTypeMerge(const ResultType a, const ResultType b);
 std::string ResultTypeAsString(ResultType t);
 
+//Analysis stages real-time mode can degrade to stay within its frame budget, combined as flags
+enum DegradedStage
+{
+	DEGRADED_NONE = 0,
+	DEGRADED_COLORBLIND = 1 << 0, //colorblind contrast checks were skipped
+	DEGRADED_RECOGNITION = 1 << 1, //text recognition was skipped, sizes are checked as if it was disabled
+	DEGRADED_DETECTION = 1 << 2 //text was detected at a coarser scale, small text may be missed
+};
+
+std::vector<std::string> DegradedStagesAsStrings(unsigned stages);
+
 struct ResultBox {
 	ResultBox(ResultType type, int x, int y, int w, int h, double value) :
 		type(type), x(x), y(y), width(w), height(h), value(value), text("") {};
@@ -40,6 +51,9 @@ struct ResultBox {
 	std::string text;
 	std::vector<double> colorblindValues = {};
 	std::vector<ResultType> colorblindTypes = {};
+	bool passes = true; //false if the box fails its check, even when the failure is reported as a warning
+	int measuredFrame = -1; //frame the box was measured on, older than the frame it is reported in when the result is reused
+	int trackId = -1; //stable ID of the box across frames when box tracking is enabled
 };
 
 struct FrameResults 
@@ -60,6 +74,10 @@ struct FrameResults
 	bool overallPass = true;
 	std::vector<bool> overallColorblindPass = { true, true, true, true };
 	std::vector<ResultType> overallColorblindType = { ResultType::PASS, ResultType::PASS, ResultType::PASS, ResultType::PASS };
+	unsigned degradedStages = DEGRADED_NONE; //DegradedStage flags of the stages real-time mode skipped or coarsened on this frame
+
+	//Adds a result measured on another frame, merging it into the overall pass and, if mergeTypes is set, into the overall types
+	void addResult(const ResultBox& box, bool mergeTypes);
 };
 
 class Results {
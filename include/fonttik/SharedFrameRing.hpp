@@ -0,0 +1,111 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/MemoryMedia.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace tik
+{
+
+/// <summary>
+/// Ring of fixed-size frame slots in named shared memory, written by a capture process and read by Fonttik without copies.
+/// The writer never writes the newest frame nor the slot the reader is analysing, so frames are read in place. A reader that falls
+/// behind jumps to the newest frame and the ones published in between are dropped. On Linux the reader sleeps on a futex until
+/// a frame is published, other platforms poll.
+/// </summary>
+class SharedFrameRing
+{
+public:
+	static constexpr uint32_t MIN_SLOTS = 3; //newest frame, frame being read and frame being written
+
+	/// <summary>
+	/// Creates the shared memory on the writer side, replacing any previous ring with the same name. It's removed when the writer is destroyed.
+	/// </summary>
+	/// <returns>nullptr if the shared memory can't be created</returns>
+	static std::unique_ptr<SharedFrameRing> create(const std::string& name, int width, int height, PixelFormat format = PixelFormat::BGR,
+		uint32_t slots = 4);
+
+	/// <summary>
+	/// Opens the ring of a running writer on the reader side
+	/// </summary>
+	/// <returns>nullptr if the shared memory doesn't exist or isn't a ring</returns>
+	static std::unique_ptr<SharedFrameRing> open(const std::string& name);
+
+	~SharedFrameRing();
+
+	SharedFrameRing(const SharedFrameRing&) = delete;
+	SharedFrameRing& operator=(const SharedFrameRing&) = delete;
+
+	/// <summary>
+	/// Returns the memory of a free slot the next frame can be drawn or copied into, rows are getStride() bytes apart
+	/// </summary>
+	uint8_t* beginWrite();
+
+	/// <summary>
+	/// Publishes the frame written since beginWrite and wakes the reader
+	/// </summary>
+	void endWrite(int frameIndex, int msTimeStamp);
+
+	/// <summary>
+	/// Copies a frame into a free slot and publishes it
+	/// </summary>
+	void publish(const uint8_t* data, size_t stride, int frameIndex, int msTimeStamp);
+
+	/// <summary>
+	/// Tells the reader no more frames will be published
+	/// </summary>
+	void close();
+
+	/// <summary>
+	/// Waits for a frame newer than the last one acquired and keeps its slot from being overwritten until the next call or release.
+	/// </summary>
+	/// <param name="timeoutMs">Maximum time to wait, negative waits until a frame arrives or the ring is closed</param>
+	/// <returns>False if the ring was closed or the timeout expired</returns>
+	bool acquireLatest(FrameBuffer& frame, int timeoutMs = -1);
+
+	/// <summary>
+	/// Lets the writer reuse the slot of the last acquired frame
+	/// </summary>
+	void release();
+
+	//Frames published after the first acquired one that the reader never got to
+	uint64_t getDroppedFrames() const { return droppedFrames; }
+
+	int getWidth() const;
+	int getHeight() const;
+	PixelFormat getFormat() const;
+	size_t getStride() const;
+
+private:
+	struct Header;
+	struct Slot;
+
+	SharedFrameRing(const std::string& name, bool owner);
+
+	bool map(size_t size);
+	void unmap();
+
+	Slot& slotAt(uint32_t slot) const;
+	uint8_t* pixelsAt(uint32_t slot) const;
+
+	std::string name;
+	bool owner; //the writer creates and removes the shared memory
+	Header* header = nullptr;
+	size_t mappedSize = 0;
+
+	uint32_t nextSlot = 0; //writer, slot tried first by the next beginWrite
+	uint32_t writingSlot = 0; //writer, slot returned by the last beginWrite
+	uint64_t writeSequence = 0; //writer, sequence of the last published frame
+
+	uint64_t readSequence = 0; //reader, sequence of the last acquired frame
+	uint64_t droppedFrames = 0;
+	bool holdingSlot = false;
+
+#ifdef _WIN32
+	void* mappingHandle = nullptr;
+#endif
+};
+
+}
@@ -0,0 +1,49 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/MemoryMedia.hpp"
+#include "fonttik/SharedFrameRing.hpp"
+#include <memory>
+
+namespace tik
+{
+
+/// <summary>
+/// Live media reading the frames a capture process publishes to a SharedFrameRing. Every loadFrame takes the newest frame,
+/// frames published while the previous one was being analysed are dropped. Frames are analysed in place in shared memory,
+/// their slot is kept from the writer until the next frame is loaded. Once the slot is released the frame is gone, so outlines
+/// are written with processMediaAsync, which copies every frame before loading the next one and stores the outlines and JSON
+/// results of each frame as MemoryMedia does. After a synchronous analysis only the JSON results can be saved, with
+/// Fonttik::saveResultsToJson, there is no frame left to draw outlines on.
+/// </summary>
+class SharedMemoryMedia : public MemoryMedia
+{
+public:
+	/// <summary>
+	/// Opens the ring of a running capture process
+	/// </summary>
+	/// <returns>nullptr if there is no ring with that name</returns>
+	static SharedMemoryMedia* open(const std::string& name, ColorblindFilters* colorblindFilters = nullptr);
+
+	SharedMemoryMedia(std::unique_ptr<SharedFrameRing> ring, const std::string& name, ColorblindFilters* colorblindFilters = nullptr);
+	virtual ~SharedMemoryMedia() = default;
+
+	/// <summary>
+	/// Waits for the newest frame of the ring
+	/// </summary>
+	/// <returns>False once the writer has closed the ring or no frame arrived within the timeout</returns>
+	virtual bool loadFrame() override;
+
+	/// <summary>
+	/// Maximum milliseconds loadFrame waits for a frame, negative waits until the writer closes the ring
+	/// </summary>
+	void setTimeout(int milliseconds) { timeoutMs = milliseconds; }
+
+	uint64_t getDroppedFrames() const { return ring->getDroppedFrames(); }
+
+private:
+	std::unique_ptr<SharedFrameRing> ring;
+	int timeoutMs = -1;
+};
+
+}
@@ -0,0 +1,95 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/MemoryMedia.hpp"
+#include <cstdio>
+#include <vector>
+
+namespace tik
+{
+
+/// <summary>
+/// Layout of the frames of a raw stream, y4m streams carry it in their header
+/// </summary>
+struct StreamFormat
+{
+	cv::Size frameSize; //empty for y4m streams
+	double fps = 0; //0 if unknown, timestamps and frame skipping need it
+	PixelFormat format = PixelFormat::BGR;
+};
+
+/// <summary>
+/// Media reading frames sequentially from stdin or a named pipe, e.g. the output of ffmpeg -f rawvideo -pix_fmt bgr24 or -f yuv4mpegpipe.
+/// Streams are never seeked and frames are read as they are analysed, only the frame being analysed is kept in memory.
+/// Raw streams need their frame size and pixel format, y4m streams (4:2:0, 4:2:2, 4:4:4 and mono, 8 bits) describe themselves.
+/// </summary>
+class StreamMedia : public MemoryMedia
+{
+public:
+	/// <summary>
+	/// Opens a stream and reads its y4m header if format has no frame size
+	/// </summary>
+	/// <param name="source">"-" for stdin, otherwise the path of a named pipe or file. Opening a pipe waits for its writer</param>
+	/// <returns>nullptr if the source can't be opened or its header is invalid</returns>
+	static StreamMedia* open(const std::string& source, const StreamFormat& format = {}, ColorblindFilters* colorblindFilters = nullptr);
+
+	virtual ~StreamMedia();
+
+	StreamMedia(const StreamMedia&) = delete;
+	StreamMedia& operator=(const StreamMedia&) = delete;
+
+	/// <summary>
+	/// Reads the next frame to analyse, frames skipped by the analysis wait or real-time mode are read and discarded
+	/// </summary>
+	/// <returns>False once the stream has ended</returns>
+	virtual bool loadFrame() override;
+
+	virtual void setAnalysisWaitSeconds(int aws) override;
+	virtual void setPlaybackPosition(int msSinceStart) override;
+
+	double getFps() const { return fps; }
+
+private:
+	//How frames are laid out in the stream
+	enum class Layout
+	{
+		Packed, //raw frames of the given PixelFormat
+		YUV420,
+		YUV422,
+		YUV444,
+		Gray
+	};
+
+	StreamMedia(std::FILE* input, const std::string& name, cv::Size frameSize, double fps, PixelFormat format, Layout layout,
+		ColorblindFilters* colorblindFilters);
+
+	//Parses the y4m stream header, the magic has already been read
+	static bool readY4MHeader(std::FILE* input, const std::string& name, cv::Size& frameSize, double& fps, Layout& layout);
+
+	size_t getFrameBytes() const;
+
+	//Reads exactly the given bytes, false if the stream ends first
+	bool read(uint8_t* data, size_t bytes);
+
+	//Reads the y4m FRAME line that precedes every frame
+	bool readFrameHeader();
+
+	//Reads the next frame of the stream without converting it
+	bool skipFrame();
+
+	//Reads the next frame of the stream and converts it to BGR
+	bool readFrame(cv::Mat& frame);
+
+	std::FILE* input;
+	PixelFormat format;
+	Layout layout;
+	double fps;
+	std::vector<uint8_t> buffer; //last frame read, reused across frames
+	cv::Mat i420; //planes of 4:2:2 and 4:4:4 frames resampled to 4:2:0
+
+	int nextFrame = 0; //index of the next frame in the stream
+	int framesToSkip = 0;
+	int playbackFrame = 0; //real-time mode, frames before this one are dropped
+};
+
+}
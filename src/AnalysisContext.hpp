@@ -0,0 +1,50 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "BoxTracker.hpp"
+#include "HudLayout.hpp"
+#include "IncrementalAnalysis.hpp"
+#include "RealTimeController.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include <chrono>
+#include <memory>
+
+namespace tik
+{
+
+/// <summary>
+/// State Fonttik keeps while analysing a single media, created when the analysis starts and dropped with the next one.
+/// Everything that depends on the media being analysed lives here or in the media itself, never in the shared Configuration.
+/// </summary>
+struct AnalysisContext
+{
+	AnalysisContext(const PerformanceParams& params, const SizeGuidelines& guideline) : guideline(guideline)
+	{
+		if (params.hudLayout)
+		{
+			hudLayout = std::make_unique<HudLayout>(params);
+		}
+		if (params.incrementalAnalysis)
+		{
+			incremental = std::make_unique<IncrementalAnalysis>(params);
+		}
+		if (params.boxTracking)
+		{
+			tracker = std::make_unique<BoxTracker>(params);
+		}
+		if (params.frameBudgetMs > 0)
+		{
+			realTime = std::make_unique<RealTimeController>(params);
+		}
+	}
+
+	SizeGuidelines guideline; //size guideline of the media resolution
+	std::unique_ptr<HudLayout> hudLayout; //nullptr when HUD layout learning is disabled
+	std::unique_ptr<IncrementalAnalysis> incremental; //nullptr when incremental analysis is disabled
+	std::unique_ptr<BoxTracker> tracker; //nullptr when box tracking is disabled
+	std::unique_ptr<RealTimeController> realTime; //nullptr when real-time mode is disabled
+	unsigned degradedStages = DEGRADED_NONE; //stages degraded on the last analysed frame
+	std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+};
+
+}
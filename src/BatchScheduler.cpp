@@ -0,0 +1,270 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/BatchScheduler.hpp"
+#include "fonttik/Fonttik.hpp"
+#include "fonttik/Media.hpp"
+#include "fonttik/Log.h"
+#include "fonttik/OutputManifest.hpp"
+#include "fonttik/DuplicateFinder.hpp"
+#include "ThreadBudget.hpp"
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <regex>
+#include <set>
+#include <thread>
+
+namespace tik
+{
+
+static const std::regex outputDir("_output$"); //folders holding results of other media
+
+//Containers scheduled as videos, only used to order the jobs so any other file is scheduled with the images
+static const std::set<std::string> videoExtensions = { ".mp4", ".m4v", ".mov", ".avi", ".mkv", ".webm", ".wmv", ".flv", ".mpg", ".mpeg",
+	".ts", ".mts", ".m2ts", ".3gp", ".ogv", ".y4m" };
+
+static bool isVideoFile(const fs::path& media)
+{
+	std::string extension = media.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return videoExtensions.count(extension) > 0;
+}
+
+BatchScheduler::BatchScheduler(const Configuration& configuration, int workers) : configuration(configuration),
+	configurationHash(configuration.getHash())
+{
+	const PerformanceParams& performanceParams = configuration.getPerformanceParams();
+	ThreadBudget::getInstance().configure(performanceParams.threadBudget, performanceParams.pinThreads);
+
+	if (workers <= 0)
+	{
+		workers = performanceParams.batchWorkers;
+	}
+	workerCount = (workers > 0) ? workers : ThreadBudget::getInstance().getThreads();
+}
+
+void BatchScheduler::add(const fs::path& media, const std::vector<fs::path>& duplicates)
+{
+	Job job;
+	job.media = media;
+	job.duplicates = duplicates;
+	//Told apart by extension, opening every file just to schedule it would double the reads
+	job.isVideo = isVideoFile(media);
+
+	std::error_code error;
+	job.size = fs::file_size(media, error);
+
+	pending.push_back(job);
+}
+
+void BatchScheduler::addFolder(const fs::path& folder, bool force)
+{
+	std::vector<fs::path> files;
+	for (const auto& directoryEntry : fs::directory_iterator(folder))
+	{
+		if (fs::is_regular_file(directoryEntry))
+		{
+			fs::path outputPath = Media::getOutputPath(directoryEntry.path().string());
+			if (!force && OutputManifest(directoryEntry.path(), configurationHash).isUpToDate(outputPath))
+			{
+				LOG_CORE_INFO("{0} results are up to date, skipping", directoryEntry.path().string());
+			}
+			else
+			{
+				files.push_back(directoryEntry.path());
+			}
+		}
+		else if (fs::is_directory(directoryEntry))
+		{
+			//Avoid endless recursion produced by analysing results and producing more results to analyse
+			if (std::regex_search(directoryEntry.path().string(), outputDir))
+			{
+				LOG_CORE_TRACE("{0} is already a results folder", directoryEntry.path().string());
+			}
+			else
+			{
+				addFolder(directoryEntry, force);
+			}
+		}
+	}
+
+	const PerformanceParams& performanceParams = configuration.getPerformanceParams();
+	if (performanceParams.deduplicateImages)
+	{
+		for (const DuplicateFinder::Cluster& cluster : DuplicateFinder(performanceParams.duplicateMaxDistance, workerCount).cluster(files))
+		{
+			add(cluster.representative, cluster.duplicates);
+		}
+	}
+	else
+	{
+		for (const fs::path& file : files)
+		{
+			add(file);
+		}
+	}
+}
+
+size_t BatchScheduler::run()
+{
+	if (pending.empty())
+	{
+		return 0;
+	}
+
+	//Longest videos first so they overlap with as many images as possible
+	std::stable_sort(pending.begin(), pending.end(), [](const Job& a, const Job& b)
+		{
+			return (a.isVideo != b.isVideo) ? a.isVideo : (a.isVideo && a.size > b.size);
+		});
+
+	//Workers share the thread budget with whatever else is running, each one's OpenCV work gets its share of what's left
+	ThreadBudget::Lease lease = ThreadBudget::getInstance().acquire(workerCount);
+
+	queues.clear();
+	for (int i = 0; i < lease.size(); i++)
+	{
+		queues.push_back(std::make_unique<WorkerQueue>());
+	}
+
+	//Dealt round robin, every worker starts with a video if there are enough of them and images fill in behind
+	for (size_t i = 0; i < pending.size(); i++)
+	{
+		queues[i % queues.size()]->jobs.push_back(std::move(pending[i]));
+	}
+
+	total = pending.size();
+	completed = 0;
+	failed = 0;
+	pending.clear();
+
+	LOG_CORE_INFO("Analysing {0} media files with {1} workers", total, queues.size());
+
+	std::vector<std::thread> workers;
+	for (size_t i = 0; i < queues.size(); i++)
+	{
+		workers.emplace_back(&BatchScheduler::work, this, i);
+	}
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	return completed - failed;
+}
+
+void BatchScheduler::work(size_t worker)
+{
+	ThreadBudget::getInstance().pinCurrentThread();
+
+	//Fonttik and its networks are only created once the worker gets a job
+	std::unique_ptr<Fonttik> fonttik;
+
+	Job job;
+	while (takeJob(worker, job))
+	{
+		if (fonttik == nullptr)
+		{
+			fonttik = std::make_unique<Fonttik>(&configuration);
+		}
+		reportProgress(job, processJob(*fonttik, job));
+	}
+}
+
+bool BatchScheduler::takeJob(size_t worker, Job& job)
+{
+	{
+		WorkerQueue& own = *queues[worker];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.jobs.empty())
+		{
+			job = std::move(own.jobs.front());
+			own.jobs.pop_front();
+			return true;
+		}
+	}
+
+	//Every job is queued before the workers start, once all queues are empty there is nothing left to wait for
+	for (size_t offset = 1; offset < queues.size(); offset++)
+	{
+		WorkerQueue& victim = *queues[(worker + offset) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.jobs.empty())
+		{
+			job = std::move(victim.jobs.back());
+			victim.jobs.pop_back();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool BatchScheduler::processJob(Fonttik& fonttik, const Job& job)
+{
+	OutputManifest manifest(job.media, configurationHash);
+
+	try
+	{
+		std::unique_ptr<Media> media(Media::createMedia(job.media.string(), fonttik.getColorblindFilters()));
+		if (media == nullptr)
+		{
+			LOG_CORE_ERROR("{0} format is not supported", job.media.filename().string());
+			return false;
+		}
+
+		if (async)
+		{
+			fonttik.processMediaAsync(*media);
+		}
+		else
+		{
+			Results results = fonttik.processMedia(*media);
+			fonttik.saveResults(*media, results);
+			fonttik.saveResultsToJson(media->getOutputPath(), results);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		LOG_CORE_ERROR("Unable to analyse {0}: {1}", job.media.string(), e.what());
+		return false;
+	}
+
+	fs::path outputPath = Media::getOutputPath(job.media.string());
+	manifest.save(outputPath);
+
+	for (const fs::path& duplicate : job.duplicates)
+	{
+		LOG_CORE_INFO("{0} is a near duplicate of {1}, reusing its results", duplicate.string(), job.media.filename().string());
+		OutputManifest duplicateManifest(duplicate, configurationHash);
+		fs::path duplicateOutput = Media::getOutputPath(duplicate.string());
+		if (DuplicateFinder::copyResults(outputPath, duplicateOutput, job.media.filename().string()))
+		{
+			duplicateManifest.save(duplicateOutput);
+		}
+	}
+
+	return true;
+}
+
+void BatchScheduler::reportProgress(const Job& job, bool succeeded)
+{
+	std::lock_guard<std::mutex> lock(progressMutex);
+	completed++;
+	if (!succeeded)
+	{
+		failed++;
+	}
+
+	Progress progress{ job.media, succeeded, completed, failed, total };
+	if (progressCallback)
+	{
+		progressCallback(progress);
+	}
+	else
+	{
+		LOG_CORE_INFO("[{0}/{1}] {2} {3}", completed, total, job.media.string(), succeeded ? "analysed" : "failed");
+	}
+}
+
+}
@@ -0,0 +1,117 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "BoxCache.hpp"
+#include "ContentHash.hpp"
+#include "fonttik/Configuration.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+
+namespace tik
+{
+
+BoxCache::BoxCache(const Configuration* config, const PerformanceParams& params) :
+	configuration(config), cache(static_cast<size_t>(params.boxCacheMemoryMB) * 1024 * 1024)
+{
+}
+
+uint64_t BoxCache::hashSettings(CheckType check, bool colorblind) const
+{
+	//Everything the checkers read from the configuration and the media guideline
+	const TextSizeParams& sizeParams = configuration->getTextSizeParams();
+	const ContrastRatioParams& contrastParams = configuration->getContrastRatioParams();
+	const double settings[] = {
+		double(check),
+		double(colorblind && check == CONTRAST_CHECK),
+		double(configuration->getAppSettings().failsAsWarnings),
+		double(sizeParams.useTextRecognition),
+		double(configuration->getPerformanceParams().lazyTextRecognition),
+		double((guideline != nullptr) ? guideline->height : -1),
+		double(contrastParams.textBackgroundRadius),
+		double(contrastParams.contrastRatio),
+		double(degradedStages)
+	};
+
+	return hashBytes(settings, sizeof(settings));
+}
+
+size_t BoxCache::entrySize(const ResultBox& result)
+{
+	//Rough footprint of an entry, including the list and index nodes
+	return sizeof(Key) + sizeof(ResultBox) + 8 * sizeof(void*) + result.text.capacity() +
+		result.colorblindValues.capacity() * sizeof(double) + result.colorblindTypes.capacity() * sizeof(ResultType);
+}
+
+std::vector<TextBox> BoxCache::match(const std::vector<TextBox>& boxes, CheckType check, bool colorblind)
+{
+	std::vector<Pending>& current = pending[check];
+	current.clear();
+
+	const uint64_t settings = hashSettings(check, colorblind);
+	std::vector<TextBox> toCheck;
+	for (const TextBox& box : boxes)
+	{
+		Pending entry{ { hashPixels(box.getSubMatrix()), settings }, box.getTextBoxRect().tl(), std::nullopt };
+		if (ResultBox* cached = cache.get(entry.key))
+		{
+			entry.cached = *cached;
+		}
+		else
+		{
+			toCheck.push_back(box);
+		}
+		current.push_back(entry);
+	}
+
+	return toCheck;
+}
+
+void BoxCache::complete(FrameResults& results, CheckType check)
+{
+	std::vector<Pending>& current = pending[check];
+
+	//Checkers add one result per box in the order they were given, cached results are put back in their place among them
+	std::vector<ResultBox> checkedResults;
+	checkedResults.swap(results.results);
+	size_t nextChecked = 0;
+	for (Pending& entry : current)
+	{
+		if (entry.cached.has_value())
+		{
+			ResultBox result = entry.cached.value();
+			result.x += entry.origin.x;
+			result.y += entry.origin.y;
+
+			//Size checks don't merge their result types into the frame type
+			results.addResult(result, check == CONTRAST_CHECK);
+		}
+		else if (nextChecked < checkedResults.size())
+		{
+			const ResultBox& result = checkedResults[nextChecked++];
+			results.results.push_back(result);
+
+			ResultBox relative = result;
+			relative.x -= entry.origin.x;
+			relative.y -= entry.origin.y;
+			relative.measuredFrame = -1;
+			relative.trackId = -1;
+			size_t size = entrySize(relative);
+			cache.put(entry.key, std::move(relative), size);
+		}
+	}
+
+	LOG_CORE_TRACE("Box cache: {} of {} boxes cached, {} entries using {} bytes",
+		current.size() - nextChecked, current.size(), cache.size(), cache.weight());
+
+	current.clear();
+}
+
+void BoxCache::clear()
+{
+	cache.clear();
+	for (int check = 0; check < CHECK_TYPE_COUNT; check++)
+	{
+		pending[check].clear();
+	}
+}
+
+}
@@ -0,0 +1,85 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "IChecker.h"
+#include "LRUCache.hpp"
+#include "fonttik/TextBox.hpp"
+#include "fonttik/Results.h"
+#include "fonttik/Metrics.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace tik
+{
+
+class Configuration;
+struct PerformanceParams;
+struct SizeGuidelines;
+
+/// <summary>
+/// Results of previously checked boxes keyed by their pixels and the settings that affect the checks.
+/// Any box identical to one seen before, anywhere in any frame or media analysed by the same Fonttik, reuses its result
+/// instead of going through luminance, masks and recognition again. Memory is bounded, least recently used entries are evicted first.
+/// </summary>
+class BoxCache
+{
+public:
+	BoxCache(const Configuration* config, const PerformanceParams& params);
+
+	/// <summary>
+	/// Looks boxes up in the cache
+	/// </summary>
+	/// <param name="colorblind">Whether contrast results include colorblind values</param>
+	/// <returns>Boxes that have to be checked, in the same order they were given</returns>
+	std::vector<TextBox> match(const std::vector<TextBox>& boxes, CheckType check, bool colorblind);
+
+	/// <summary>
+	/// Stores the results of the boxes returned by the last match and completes them with the cached ones, in the order the boxes were matched in
+	/// </summary>
+	void complete(FrameResults& results, CheckType check);
+
+	void clear();
+
+	//Size guideline of the media being analysed, part of the key of size results
+	void setGuideline(const SizeGuidelines* activeGuideline) { guideline = activeGuideline; }
+
+	//Stages real-time mode degraded on the frame being analysed, part of the key so degraded results are never reused on full frames
+	void setDegradedStages(unsigned stages) { degradedStages = stages; }
+
+	const CacheStats& getStats() const { return cache.getStats(); }
+	size_t getMemoryUsage() const { return cache.weight(); }
+
+private:
+	struct Key
+	{
+		uint64_t content;
+		uint64_t settings;
+
+		bool operator==(const Key& other) const { return content == other.content && settings == other.settings; }
+	};
+
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const { return static_cast<size_t>(key.content ^ (key.settings * 1099511628211ull)); }
+	};
+
+	struct Pending
+	{
+		Key key;
+		cv::Point origin; //results are cached relative to the box they were measured in
+		std::optional<ResultBox> cached;
+	};
+
+	uint64_t hashSettings(CheckType check, bool colorblind) const;
+
+	static size_t entrySize(const ResultBox& result);
+
+	const Configuration* configuration;
+	const SizeGuidelines* guideline = nullptr;
+	unsigned degradedStages = DEGRADED_NONE;
+	LRUCache<Key, ResultBox, KeyHash> cache;
+	std::vector<Pending> pending[CHECK_TYPE_COUNT];
+};
+
+}
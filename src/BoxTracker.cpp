@@ -0,0 +1,118 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "BoxTracker.hpp"
+#include "ContentHash.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+
+namespace tik
+{
+
+BoxTracker::BoxTracker(const PerformanceParams& params) : minIoU(params.trackingMinIoU)
+{
+}
+
+float BoxTracker::intersectionOverUnion(const cv::Rect& a, const cv::Rect& b)
+{
+	const int intersection = (a & b).area();
+	const int unionArea = a.area() + b.area() - intersection;
+	return (unionArea <= 0) ? 0.0f : float(intersection) / unionArea;
+}
+
+std::vector<TextBox> BoxTracker::match(const std::vector<TextBox>& boxes, CheckType check)
+{
+	std::vector<Track>& previous = tracks[check];
+	std::vector<Track>& current = pending[check];
+	current.clear();
+
+	std::vector<bool> taken(previous.size(), false);
+	std::vector<TextBox> toCheck;
+
+	for (const TextBox& box : boxes)
+	{
+		const cv::Rect rect = box.getTextBoxRect();
+
+		//Each track continues in at most one box, the one overlapping it the most
+		int best = -1;
+		float bestIoU = minIoU;
+		for (size_t i = 0; i < previous.size(); i++)
+		{
+			float iou = taken[i] ? 0.0f : intersectionOverUnion(rect, previous[i].rect);
+			if (iou >= bestIoU)
+			{
+				best = static_cast<int>(i);
+				bestIoU = iou;
+			}
+		}
+
+		Track track{ -1, rect, hashPixels(box.getSubMatrix()), std::nullopt };
+		if (best >= 0)
+		{
+			taken[best] = true;
+			track.id = previous[best].id;
+			stats.matchedBoxes++;
+
+			//Same place and same pixels give the same result
+			if (previous[best].rect == rect && previous[best].hash == track.hash && previous[best].result.has_value())
+			{
+				track.result = previous[best].result;
+				stats.reusedBoxes++;
+			}
+		}
+		else
+		{
+			track.id = nextId[check]++;
+			stats.newTracks++;
+		}
+
+		if (!track.result.has_value())
+		{
+			toCheck.push_back(box);
+		}
+		current.push_back(track);
+	}
+
+	return toCheck;
+}
+
+void BoxTracker::complete(FrameResults& results, CheckType check)
+{
+	std::vector<Track>& current = pending[check];
+
+	//Checkers add one result per box in the order they were given, reused results are put back in their place among them
+	std::vector<ResultBox> checkedResults;
+	checkedResults.swap(results.results);
+	size_t nextChecked = 0;
+	for (Track& track : current)
+	{
+		if (track.result.has_value())
+		{
+			//Size checks don't merge their result types into the frame type
+			results.addResult(track.result.value(), check == CONTRAST_CHECK);
+		}
+		else if (nextChecked < checkedResults.size())
+		{
+			ResultBox& result = checkedResults[nextChecked++];
+			result.trackId = track.id;
+			result.measuredFrame = results.frame;
+			track.result = result;
+			results.results.push_back(result);
+		}
+	}
+
+	LOG_CORE_TRACE("{} tracked boxes, {} reused", current.size(), current.size() - nextChecked);
+
+	tracks[check].swap(current);
+	current.clear();
+}
+
+void BoxTracker::reset()
+{
+	for (int check = 0; check < CHECK_TYPE_COUNT; check++)
+	{
+		tracks[check].clear();
+		pending[check].clear();
+	}
+}
+
+}
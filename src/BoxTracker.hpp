@@ -0,0 +1,66 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "IChecker.h"
+#include "fonttik/TextBox.hpp"
+#include "fonttik/Results.h"
+#include "fonttik/Metrics.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace tik
+{
+
+struct PerformanceParams;
+
+/// <summary>
+/// Follows text boxes across analysed frames, giving them stable track IDs.
+/// Boxes that stay in place with the same pixels reuse the result of the previous frame instead of being checked again.
+/// Size and contrast checks are tracked separately, as they run on lines and words respectively.
+/// </summary>
+class BoxTracker
+{
+public:
+	BoxTracker(const PerformanceParams& params);
+
+	/// <summary>
+	/// Matches boxes with the tracks of the previous frame
+	/// </summary>
+	/// <returns>Boxes that have to be checked, in the same order they were given</returns>
+	std::vector<TextBox> match(const std::vector<TextBox>& boxes, CheckType check);
+
+	/// <summary>
+	/// Completes the results of the boxes returned by the last match with the reused ones, in the order the boxes were matched in.
+	/// Sets the track IDs and keeps everything as the tracks for the next frame
+	/// </summary>
+	void complete(FrameResults& results, CheckType check);
+
+	/// <summary>
+	/// Drops all tracks, next boxes start new ones
+	/// </summary>
+	void reset();
+
+	TrackingStats getStats() const { return stats; }
+
+	static float intersectionOverUnion(const cv::Rect& a, const cv::Rect& b);
+
+private:
+	struct Track
+	{
+		int id;
+		cv::Rect rect;
+		uint64_t hash;
+		std::optional<ResultBox> result; //empty until the box has been checked
+	};
+
+	float minIoU;
+
+	std::vector<Track> tracks[CHECK_TYPE_COUNT]; //tracks of the previous frame
+	std::vector<Track> pending[CHECK_TYPE_COUNT]; //tracks of the frame being analysed, in box order
+	int nextId[CHECK_TYPE_COUNT] = { 0, 0 };
+
+	TrackingStats stats;
+};
+
+}
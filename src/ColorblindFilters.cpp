@@ -13,7 +13,7 @@ namespace tik
 			a.at<double>(0, 0) * b.at<double>(1, 0) - a.at<double>(1, 0) * b.at<double>(0, 0));
 	}
 
-	ColorblindFilters::ColorblindFilters(Configuration* config) {
+	ColorblindFilters::ColorblindFilters(const Configuration* config) {
 		configuration = config;
 		cv::Mat XYZJuddVosToLMS = configuration->getXYZJuddVosToLMSMatrix();
 		LMSToLinearRGBMatrix = configuration->getLMSToLinearRGBMatrix();
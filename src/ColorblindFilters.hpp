@@ -7,14 +7,14 @@ namespace tik
 {
     class ColorblindFilters {
     public:
-        ColorblindFilters(Configuration* config);
+        ColorblindFilters(const Configuration* config);
 
         virtual ~ColorblindFilters() {}
 
         std::vector<cv::Mat> applyColorblindFilters(const cv::Mat& frame);
         
     private:
-        Configuration* configuration;
+        const Configuration* configuration;
 
         // XYZ Judd-Vos coordinates for 485nm and 660 nm wavelengths
 		// Values taken from DaltonLens which they took from http://www.cvrl.org/
@@ -4,7 +4,9 @@
 #include <array>
 #include "fonttik/Log.h"
 #include "fonttik/Results.h"
+#include "ContentHash.hpp"
 #include <fstream>
+#include <map>
 
 namespace tik
 {
@@ -73,6 +75,20 @@ void Configuration::init(const char* filePath)
 	}
 
 	loadTextRecognitionParams(config["textRecognition"]);
+
+	const std::string fileSettings = config.dump();
+	fileHash = hashBytes(fileSettings.data(), fileSettings.size());
+
+	const std::string detectionSettings = detectionBackend + config["textDetection"].dump();
+	const std::string recognitionSettings = config["textRecognition"].dump();
+	detectionHash = hashBytes(detectionSettings.data(), detectionSettings.size());
+	recognitionHash = hashBytes(recognitionSettings.data(), recognitionSettings.size());
+
+	//Performance tuning is optional, older configuration files keep the defaults
+	if (config.contains("performance"))
+	{
+		loadPerformanceParams(config["performance"]);
+	}
 }
 
 void Configuration::loadAppSettings(const json& section)
@@ -88,8 +104,10 @@ void Configuration::loadAppSettings(const json& section)
 	int analysisWaitSeconds = section["analysisWaitSeconds"];
 	bool detectResolution = section["detectResolution"];
 	bool sizeByLine = section["sizeByLine"];
+	bool useColorblindFilters = section.value("useColorblindFilters", true);
 
-	appSettings = { targetDPI, targetResolution, saveTextboxOutline, saveLogs, printResultValues, failsAsWarnings, useDPI, analysisWaitSeconds, detectResolution, sizeByLine};
+	appSettings = { targetDPI, targetResolution, saveTextboxOutline, saveLogs, printResultValues, failsAsWarnings, useDPI, analysisWaitSeconds, detectResolution, sizeByLine,
+		useColorblindFilters };
 }
 
 void Configuration::loadMaskParams(const json& section)
@@ -138,6 +156,7 @@ void Configuration::loadTextDetectionParams(const json& section)
 	std::string preferredTarget = section["preferredTarget"];
 	textDetectionParams = { confidence, mergeThreshold, rotationThresholdDegrees, groupByCharacters, 
 		textDetectionParams.getBackendParam(preferredBackend), textDetectionParams.getTargetParam(preferredTarget)};
+	textDetectionParams.inputCacheSize = section.value("inputCacheSize", 8);
 }
 
 void Configuration::loadTextRecognitionParams(const json& section)
@@ -160,7 +179,13 @@ void Configuration::loadEASTParams(const json& section)
 	float detectionScale = section["detectionScale"];
 	std::array<double, 3> detectionMean = { section["detectionMean"][0], section["detectionMean"][1], section["detectionMean"][2] };
 
-	textDetectionParams.eastParams = {detectionModel, nmsThreshold, detectionScale, detectionMean};
+	bool customDecode = section.value("customDecode", false);
+	bool refineHighResolution = section.value("refineHighResolution", false);
+	int refineDetectionHeight = section.value("refineDetectionHeight", 1080);
+	int refinePadding = section.value("refinePadding", 32);
+
+	textDetectionParams.eastParams = {detectionModel, nmsThreshold, detectionScale, detectionMean, customDecode,
+		refineHighResolution, refineDetectionHeight, refinePadding};
 }
 
 void Configuration::loadDiffBinarizationParams(const json& section)
@@ -174,7 +199,94 @@ void Configuration::loadDiffBinarizationParams(const json& section)
 	std::array<double, 3> detectionMean = { section["detectionMean"][0], section["detectionMean"][1], section["detectionMean"][2] };
 	std::array<int, 2> inputSize = { section["inputSize"][0], section["inputSize"][1] };
 
-	textDetectionParams.dbParams = { detectionModel, binaryThreshold, polygonThreshold, maxCandidates, unclipRatio, scale, detectionMean, inputSize };
+	bool preserveAspectRatio = section.value("preserveAspectRatio", true);
+	int maxInputPixels = section.value("maxInputPixels", inputSize[0] * inputSize[1]);
+	int inputStride = section.value("inputStride", 32);
+
+	textDetectionParams.dbParams = { detectionModel, binaryThreshold, polygonThreshold, maxCandidates, unclipRatio, scale, detectionMean, inputSize,
+		preserveAspectRatio, maxInputPixels, inputStride };
+}
+
+void Configuration::loadPerformanceParams(const json& section)
+{
+	bool parallelModelLoading = section.value("parallelModelLoading", true);
+	bool warmUpModels = section.value("warmUpModels", true);
+	std::array<int, 2> warmUpResolution = section.value("warmUpResolution", std::array<int, 2>{ 1920, 1080 });
+	bool textPrefilter = section.value("textPrefilter", false);
+	float prefilterThreshold = section.value("prefilterThreshold", 0.02f);
+	std::array<int, 2> prefilterGrid = section.value("prefilterGrid", std::array<int, 2>{ 8, 6 });
+	int prefilterWidth = section.value("prefilterWidth", 480);
+	bool autoCropBorders = section.value("autoCropBorders", false);
+	int borderThreshold = section.value("borderThreshold", 16);
+	bool hudLayout = section.value("hudLayout", false);
+	int hudLearningFrames = section.value("hudLearningFrames", 10);
+	int hudRescanInterval = section.value("hudRescanInterval", 30);
+	float hudMinHitRatio = section.value("hudMinHitRatio", 0.1f);
+	int hudRegionMargin = section.value("hudRegionMargin", 16);
+	int hudMaxRegions = section.value("hudMaxRegions", 4);
+	bool incrementalAnalysis = section.value("incrementalAnalysis", false);
+	int incrementalTileSize = section.value("incrementalTileSize", 64);
+	int incrementalMargin = section.value("incrementalMargin", 32);
+	int incrementalPixelThreshold = section.value("incrementalPixelThreshold", 12);
+	float incrementalMaxChangedArea = section.value("incrementalMaxChangedArea", 0.5f);
+	bool boxTracking = section.value("boxTracking", false);
+	float trackingMinIoU = section.value("trackingMinIoU", 0.5f);
+	bool boxCache = section.value("boxCache", false);
+	int boxCacheMemoryMB = section.value("boxCacheMemoryMB", 64);
+	bool detectionCache = section.value("detectionCache", false);
+	std::string detectionCachePath = section.value("detectionCachePath", std::string("detectionCache.bin"));
+	bool deduplicateImages = section.value("deduplicateImages", false);
+	int duplicateMaxDistance = section.value("duplicateMaxDistance", 4);
+	bool lazyTextRecognition = section.value("lazyTextRecognition", false);
+	int batchWorkers = section.value("batchWorkers", 0);
+	int videoSegments = section.value("videoSegments", 1);
+	int threadBudget = section.value("threadBudget", 0);
+	bool pinThreads = section.value("pinThreads", false);
+	double frameBudgetMs = section.value("frameBudgetMs", 0.0);
+	float realTimeDetectionScale = section.value("realTimeDetectionScale", 0.5f);
+
+	performanceParams = { parallelModelLoading, warmUpModels, warmUpResolution, textPrefilter, prefilterThreshold, prefilterGrid, prefilterWidth,
+		autoCropBorders, borderThreshold, hudLayout, hudLearningFrames, hudRescanInterval, hudMinHitRatio, hudRegionMargin, hudMaxRegions,
+		incrementalAnalysis, incrementalTileSize, incrementalMargin, incrementalPixelThreshold, incrementalMaxChangedArea,
+		boxTracking, trackingMinIoU, boxCache, boxCacheMemoryMB,
+		detectionCache, detectionCachePath, deduplicateImages, duplicateMaxDistance,
+		lazyTextRecognition, batchWorkers, videoSegments,
+		threadBudget, pinThreads, frameBudgetMs, realTimeDetectionScale };
+}
+
+uint64_t Configuration::getHash() const
+{
+	uint64_t hash = fileHash;
+	auto add = [&hash](const auto& value) { hash = hashBytes(&value, sizeof(value), hash); };
+
+	add(appSettings.analysisWaitSeconds);
+	add(appSettings.detectResolution);
+	add(appSettings.failsAsWarnings);
+	add(appSettings.sizeByLine);
+	add(appSettings.useColorblindFilters);
+	hash = hashBytes(appSettings.targetResolution.data(), appSettings.targetResolution.size(), hash);
+	add(textSizeParams.useTextRecognition);
+	add(contrastRatioParams.contrastRatio);
+	for (const std::vector<cv::Rect2f>* masks : { &maskParams.focusMasks, &maskParams.ignoreMasks })
+	{
+		for (const cv::Rect2f& mask : *masks)
+		{
+			const float values[4] = { mask.x, mask.y, mask.width, mask.height };
+			add(values);
+		}
+		add(masks->size());
+	}
+
+	//Guidelines are hashed in a fixed order
+	std::map<std::string, SizeGuidelines> guidelines(textSizeParams.resolutionGuidelines.begin(), textSizeParams.resolutionGuidelines.end());
+	for (const auto& [name, guideline] : guidelines)
+	{
+		hash = hashBytes(name.data(), name.size(), hash);
+		add(guideline.width);
+		add(guideline.height);
+	}
+
+	return hash;
 }
 
 cv::Mat Configuration::loadMatrix(const json& section)
@@ -228,18 +340,26 @@ std::unordered_map<std::string, SizeGuidelines> Configuration::loadSizeGuideline
 
 bool Configuration::setResolutionGuideline(const std::string& resolutionKey)
 {
-	std::unordered_map<std::string, SizeGuidelines>::iterator it;
-	it = textSizeParams.resolutionGuidelines.find(resolutionKey);
+	const SizeGuidelines* guideline = findResolutionGuideline(resolutionKey);
+	if (guideline != nullptr)
+	{
+		textSizeParams.activeGuideline = guideline;
+	}
+	return guideline != nullptr;
+}
+
+const SizeGuidelines* Configuration::findResolutionGuideline(const std::string& resolutionKey) const
+{
+	auto it = textSizeParams.resolutionGuidelines.find(resolutionKey);
 	
 	if (it != textSizeParams.resolutionGuidelines.end())
 	{
-		textSizeParams.activeGuideline = &it->second;
-		return true;
+		return &it->second;
 	}
 	else
 	{
 		LOG_CORE_ERROR("Resolution guideline not found for image width: {}", resolutionKey);
-		return false;
+		return nullptr;
 	}
 }
 
@@ -0,0 +1,43 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <opencv2/core.hpp>
+#include <cstdint>
+
+namespace tik
+{
+
+static const uint64_t CONTENT_HASH_SEED = 14695981039346656037ull;
+
+/// <summary>
+/// 64 bit FNV-1a hash of a block of memory, chained from a previous hash
+/// </summary>
+inline uint64_t hashBytes(const void* data, size_t size, uint64_t hash = CONTENT_HASH_SEED)
+{
+	const uint64_t prime = 1099511628211ull;
+	const uchar* bytes = static_cast<const uchar*>(data);
+	for (size_t i = 0; i < size; i++)
+	{
+		hash = (hash ^ bytes[i]) * prime;
+	}
+	return hash;
+}
+
+/// <summary>
+/// Hash of the pixels of an image, its size and type. Works on non continuous submatrices.
+/// </summary>
+inline uint64_t hashPixels(const cv::Mat& image, uint64_t hash = CONTENT_HASH_SEED)
+{
+	const int header[3] = { image.rows, image.cols, image.type() };
+	hash = hashBytes(header, sizeof(header), hash);
+
+	const size_t rowSize = image.cols * image.elemSize();
+	for (int row = 0; row < image.rows; row++)
+	{
+		hash = hashBytes(image.ptr<uchar>(row), rowSize, hash);
+	}
+
+	return hash;
+}
+
+}
@@ -51,6 +51,7 @@ FrameResults tik::ContrastChecker::check(const int& frameIndex, std::vector<Text
 
 		bool boxPasses = results.first == ResultType::PASS;
 		contrastResults.overallPass = contrastResults.overallPass && boxPasses;
+		contrastResults.results.back().passes = boxPasses;
 		contrastResults.overallType = ResultTypeMerge(contrastResults.overallType, results.first);
 		contrastResults.results.back().text = textBox.getText();
 	}
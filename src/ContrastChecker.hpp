@@ -10,7 +10,7 @@ namespace tik
 class ContrastChecker : public IChecker 
 {
 public:
-	ContrastChecker(Configuration* config) : IChecker(config) {}
+	ContrastChecker(const Configuration* config) : IChecker(config) {}
 
 	virtual ~ContrastChecker() {}
 
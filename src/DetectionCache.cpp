@@ -0,0 +1,239 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "DetectionCache.hpp"
+#include "MappedFile.hpp"
+#include "fonttik/Log.h"
+#include <cstring>
+#include <filesystem>
+#include <map>
+
+namespace tik
+{
+
+std::shared_ptr<DetectionCache> DetectionCache::open(const std::string& path)
+{
+	static std::mutex registryMutex;
+	static std::map<std::string, std::weak_ptr<DetectionCache>> openCaches;
+
+	const std::string key = std::filesystem::absolute(path).lexically_normal().string();
+
+	std::lock_guard<std::mutex> lock(registryMutex);
+	if (std::shared_ptr<DetectionCache> cache = openCaches[key].lock())
+	{
+		return cache;
+	}
+
+	std::shared_ptr<DetectionCache> cache = std::make_shared<DetectionCache>(path);
+	openCaches[key] = cache;
+	return cache;
+}
+
+DetectionCache::DetectionCache(const std::string& path) : path(path)
+{
+	load();
+
+	output.open(path, std::ios::binary | std::ios::app);
+	if (!output.is_open())
+	{
+		LOG_CORE_ERROR("Unable to open detection cache {} for writing, new results won't be cached", path);
+	}
+}
+
+DetectionCache::~DetectionCache()
+{
+	//Views into the mapping are dropped before unmapping it
+	index.clear();
+}
+
+void DetectionCache::load()
+{
+	std::error_code error;
+	if (!std::filesystem::exists(path, error) || std::filesystem::file_size(path, error) == 0)
+	{
+		return;
+	}
+
+	mapped = std::make_unique<MappedFile>(path);
+
+	const char* data = mapped->data();
+	const size_t size = mapped->size();
+	size_t offset = 0;
+	while (offset + RECORD_HEADER_SIZE <= size)
+	{
+		uint32_t magic, payloadSize;
+		Key key;
+		const char* header = data + offset;
+		std::memcpy(&magic, header, sizeof(magic));
+		std::memcpy(&key.type, header + 4, sizeof(key.type));
+		std::memcpy(&key.content, header + 5, sizeof(key.content));
+		std::memcpy(&key.params, header + 13, sizeof(key.params));
+		std::memcpy(&payloadSize, header + 21, sizeof(payloadSize));
+
+		if (magic != RECORD_MAGIC || offset + RECORD_HEADER_SIZE + payloadSize > size)
+		{
+			LOG_CORE_WARNING("Detection cache {} is damaged after {} bytes, the rest is ignored", path, offset);
+			break;
+		}
+
+		index[key] = std::string_view(data + offset + RECORD_HEADER_SIZE, payloadSize);
+		offset += RECORD_HEADER_SIZE + payloadSize;
+	}
+
+	//Anything after the last complete record is cut so new records aren't appended behind garbage
+	if (offset < size)
+	{
+		index.clear();
+		mapped.reset();
+		std::filesystem::resize_file(path, offset, error);
+		if (!error && offset > 0)
+		{
+			load();
+		}
+		return;
+	}
+
+	LOG_CORE_DEBUG("Loaded {} records from detection cache {}", index.size(), path);
+}
+
+std::optional<std::string_view> DetectionCache::find(const Key& key, CacheStats& stats)
+{
+	auto it = index.find(key);
+	if (it == index.end())
+	{
+		stats.misses++;
+		return std::nullopt;
+	}
+	stats.hits++;
+	return it->second;
+}
+
+void DetectionCache::append(const Key& key, const std::string& payload)
+{
+	if (index.count(key) != 0)
+	{
+		return;
+	}
+
+	appendedPayloads.push_back(payload);
+	index[key] = appendedPayloads.back();
+
+	if (!output.is_open())
+	{
+		return;
+	}
+
+	//Records are appended under the mutex, every user in the process shares this instance. Writes of other processes aren't
+	//synchronised, only one process may use a cache file at a time
+	const uint32_t payloadSize = static_cast<uint32_t>(payload.size());
+	std::string record(RECORD_HEADER_SIZE, '\0');
+	std::memcpy(&record[0], &RECORD_MAGIC, sizeof(RECORD_MAGIC));
+	std::memcpy(&record[4], &key.type, sizeof(key.type));
+	std::memcpy(&record[5], &key.content, sizeof(key.content));
+	std::memcpy(&record[13], &key.params, sizeof(key.params));
+	std::memcpy(&record[21], &payloadSize, sizeof(payloadSize));
+	record += payload;
+
+	output.write(record.data(), record.size());
+	output.flush();
+}
+
+void DetectionCache::writeRects(std::string& payload, const std::vector<cv::Rect>& rects)
+{
+	const uint32_t count = static_cast<uint32_t>(rects.size());
+	payload.append(reinterpret_cast<const char*>(&count), sizeof(count));
+	for (const cv::Rect& rect : rects)
+	{
+		const int32_t values[4] = { rect.x, rect.y, rect.width, rect.height };
+		payload.append(reinterpret_cast<const char*>(values), sizeof(values));
+	}
+}
+
+bool DetectionCache::readRects(std::string_view& payload, std::vector<cv::Rect>& rects)
+{
+	uint32_t count;
+	if (payload.size() < sizeof(count))
+	{
+		return false;
+	}
+	std::memcpy(&count, payload.data(), sizeof(count));
+	payload.remove_prefix(sizeof(count));
+
+	if (payload.size() < count * 4 * sizeof(int32_t))
+	{
+		return false;
+	}
+
+	rects.resize(count);
+	for (cv::Rect& rect : rects)
+	{
+		int32_t values[4];
+		std::memcpy(values, payload.data(), sizeof(values));
+		payload.remove_prefix(sizeof(values));
+		rect = cv::Rect(values[0], values[1], values[2], values[3]);
+	}
+	return true;
+}
+
+std::optional<DetectionCache::Detection> DetectionCache::getDetection(uint64_t contentHash, uint64_t paramsHash)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::optional<std::string_view> payload = find({ DETECTION_RECORD, contentHash, paramsHash }, detectionStats);
+	if (!payload.has_value())
+	{
+		return std::nullopt;
+	}
+
+	Detection detection;
+	if (!readRects(payload.value(), detection.words) || !readRects(payload.value(), detection.lines))
+	{
+		return std::nullopt;
+	}
+	return detection;
+}
+
+void DetectionCache::putDetection(uint64_t contentHash, uint64_t paramsHash, const Detection& detection)
+{
+	std::string payload;
+	writeRects(payload, detection.words);
+	writeRects(payload, detection.lines);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	append({ DETECTION_RECORD, contentHash, paramsHash }, payload);
+}
+
+std::optional<std::string> DetectionCache::getText(uint64_t contentHash, uint64_t paramsHash)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::optional<std::string_view> payload = find({ TEXT_RECORD, contentHash, paramsHash }, textStats);
+	if (!payload.has_value())
+	{
+		return std::nullopt;
+	}
+	return std::string(payload.value());
+}
+
+void DetectionCache::putText(uint64_t contentHash, uint64_t paramsHash, const std::string& text)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	append({ TEXT_RECORD, contentHash, paramsHash }, text);
+}
+
+CacheStats DetectionCache::getDetectionStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return detectionStats;
+}
+
+CacheStats DetectionCache::getTextStats() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return textStats;
+}
+
+size_t DetectionCache::size() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return index.size();
+}
+
+}
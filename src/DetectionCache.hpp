@@ -0,0 +1,101 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/Metrics.hpp"
+#include <opencv2/core.hpp>
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace tik
+{
+
+class MappedFile;
+
+/// <summary>
+/// Append-only cache file of detection and recognition outputs, so reruns with different checker settings skip inference.
+/// Detections are keyed by a hash of the frame pixels and recognitions by a hash of the box pixels, both together with a hash
+/// of the model parameters that produced them. Records already in the file are read through a memory mapping, new ones are
+/// appended as they are produced. A truncated last record, e.g. from a killed run, is ignored. Only one process may use a cache
+/// file at a time, appends from several processes could interleave records.
+/// </summary>
+class DetectionCache
+{
+public:
+	struct Detection
+	{
+		std::vector<cv::Rect> words;
+		std::vector<cv::Rect> lines;
+	};
+
+	/// <summary>
+	/// Returns the cache of the given file, shared by every user in the process
+	/// </summary>
+	static std::shared_ptr<DetectionCache> open(const std::string& path);
+
+	DetectionCache(const std::string& path);
+	~DetectionCache();
+
+	DetectionCache(const DetectionCache&) = delete;
+	DetectionCache& operator=(const DetectionCache&) = delete;
+
+	std::optional<Detection> getDetection(uint64_t contentHash, uint64_t paramsHash);
+	void putDetection(uint64_t contentHash, uint64_t paramsHash, const Detection& detection);
+
+	std::optional<std::string> getText(uint64_t contentHash, uint64_t paramsHash);
+	void putText(uint64_t contentHash, uint64_t paramsHash, const std::string& text);
+
+	CacheStats getDetectionStats() const;
+	CacheStats getTextStats() const;
+	size_t size() const;
+
+private:
+	enum RecordType : uint8_t
+	{
+		DETECTION_RECORD = 1,
+		TEXT_RECORD = 2
+	};
+
+	struct Key
+	{
+		uint8_t type;
+		uint64_t content;
+		uint64_t params;
+
+		bool operator==(const Key& other) const { return type == other.type && content == other.content && params == other.params; }
+	};
+
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const { return static_cast<size_t>(key.content ^ (key.params * 1099511628211ull) ^ key.type); }
+	};
+
+	void load();
+	std::optional<std::string_view> find(const Key& key, CacheStats& stats);
+	void append(const Key& key, const std::string& payload);
+
+	static void writeRects(std::string& payload, const std::vector<cv::Rect>& rects);
+	static bool readRects(std::string_view& payload, std::vector<cv::Rect>& rects);
+
+	static const uint32_t RECORD_MAGIC = 0x52544B46; //"FKTR"
+	static const size_t RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + 2 * sizeof(uint64_t) + sizeof(uint32_t);
+
+	std::string path;
+	mutable std::mutex mutex;
+	std::unique_ptr<MappedFile> mapped; //records found in the file when it was opened
+	std::list<std::string> appendedPayloads; //records added since, the list keeps the views into them valid
+	std::unordered_map<Key, std::string_view, KeyHash> index;
+	std::ofstream output;
+
+	CacheStats detectionStats;
+	CacheStats textStats;
+};
+
+}
@@ -0,0 +1,169 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/DuplicateFinder.hpp"
+#include "fonttik/Log.h"
+#include "ThreadBudget.hpp"
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <fstream>
+#include <thread>
+
+namespace tik
+{
+
+DuplicateFinder::DuplicateFinder(int maxDistance, int threads) : maxDistance(maxDistance),
+	threads((threads > 0) ? threads : ThreadBudget::getInstance().getThreads())
+{
+}
+
+uint64_t DuplicateFinder::perceptualHash(const cv::Mat& image)
+{
+	cv::Mat gray, small, coefficients;
+	if (image.channels() == 1)
+	{
+		gray = image;
+	}
+	else
+	{
+		cv::cvtColor(image, gray, (image.channels() == 4) ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+	}
+	cv::resize(gray, small, cv::Size(32, 32), 0, 0, cv::INTER_AREA);
+	small.convertTo(small, CV_32F);
+	cv::dct(small, coefficients);
+
+	//Lowest 8x8 frequencies, compared with their median. The DC term only carries the overall brightness
+	std::vector<float> lowFrequencies;
+	for (int y = 0; y < 8; y++)
+	{
+		for (int x = 0; x < 8; x++)
+		{
+			lowFrequencies.push_back(coefficients.at<float>(y, x));
+		}
+	}
+	std::vector<float> sorted(lowFrequencies.begin() + 1, lowFrequencies.end());
+	std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+	const float median = sorted[sorted.size() / 2];
+
+	uint64_t hash = 0;
+	for (size_t i = 1; i < lowFrequencies.size(); i++)
+	{
+		if (lowFrequencies[i] > median)
+		{
+			hash |= uint64_t(1) << i;
+		}
+	}
+	return hash;
+}
+
+int DuplicateFinder::distance(uint64_t a, uint64_t b)
+{
+	return static_cast<int>(std::bitset<64>(a ^ b).count());
+}
+
+std::vector<std::vector<size_t>> DuplicateFinder::groupHashes(const std::vector<ImageHash>& hashes, int maxDistance)
+{
+	std::vector<std::vector<size_t>> groups;
+	for (size_t i = 0; i < hashes.size(); i++)
+	{
+		//Results are copied between duplicates as they are, so sizes must match exactly
+		auto group = std::find_if(groups.begin(), groups.end(), [&](const std::vector<size_t>& candidate)
+			{
+				const ImageHash& representative = hashes[candidate.front()];
+				return !hashes[i].size.empty() && representative.size == hashes[i].size &&
+					distance(representative.hash, hashes[i].hash) <= maxDistance;
+			});
+
+		if (group != groups.end())
+		{
+			group->push_back(i);
+		}
+		else
+		{
+			groups.push_back({ i });
+		}
+	}
+	return groups;
+}
+
+std::vector<DuplicateFinder::Cluster> DuplicateFinder::cluster(const std::vector<fs::path>& files) const
+{
+	//Decoding dominates, each thread takes the next file until none are left
+	std::vector<ImageHash> hashes(files.size());
+	std::atomic<size_t> next = 0;
+	auto hashFiles = [&]()
+		{
+			for (size_t i = next++; i < files.size(); i = next++)
+			{
+				cv::Mat image = cv::imread(files[i].string(), cv::IMREAD_GRAYSCALE);
+				if (!image.empty())
+				{
+					hashes[i] = { perceptualHash(image), image.size() };
+				}
+			}
+		};
+
+	ThreadBudget::Lease lease = ThreadBudget::getInstance().acquire(std::min<int>(threads, static_cast<int>(files.size())));
+	std::vector<std::thread> workers;
+	for (int i = 1; i < lease.size(); i++)
+	{
+		workers.emplace_back(hashFiles);
+	}
+	hashFiles();
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	std::vector<Cluster> clusters;
+	for (const std::vector<size_t>& group : groupHashes(hashes, maxDistance))
+	{
+		Cluster cluster{ files[group.front()], {} };
+		for (size_t i = 1; i < group.size(); i++)
+		{
+			cluster.duplicates.push_back(files[group[i]]);
+		}
+		clusters.push_back(cluster);
+	}
+
+	LOG_CORE_DEBUG("{} files grouped in {} clusters", files.size(), clusters.size());
+	return clusters;
+}
+
+bool DuplicateFinder::copyResults(const fs::path& representativeOutput, const fs::path& duplicateOutput, const std::string& representativeName)
+{
+	using json = nlohmann::json;
+
+	std::error_code error;
+	fs::create_directories(duplicateOutput, error);
+
+	for (const char* name : { "sizeChecks.json", "contrastChecks.json" })
+	{
+		json results;
+		try
+		{
+			std::ifstream in(representativeOutput / name);
+			results = json::parse(in);
+		}
+		catch (const std::exception& e)
+		{
+			LOG_CORE_ERROR("Unable to read {} of {}: {}", name, representativeName, e.what());
+			return false;
+		}
+
+		for (json& frame : results)
+		{
+			frame["deduplicatedFrom"] = representativeName;
+		}
+
+		std::ofstream out(duplicateOutput / name);
+		out << results.dump();
+	}
+
+	return true;
+}
+
+}
@@ -0,0 +1,203 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "EASTDecoder.hpp"
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace tik
+{
+
+void EASTDecoder::decode(const cv::Mat& scores, const cv::Mat& geometry, float confidenceThreshold,
+	const cv::Size& inputSize, const cv::Size& frameSize, std::vector<Quad>& quads, std::vector<float>& confidences)
+{
+	CV_Assert(scores.dims == 4 && geometry.dims == 4 && geometry.size[1] == 5);
+	CV_Assert(scores.size[2] == geometry.size[2] && scores.size[3] == geometry.size[3]);
+
+	const int height = scores.size[2];
+	const int width = scores.size[3];
+	const size_t planeSize = static_cast<size_t>(height) * width;
+
+	//Threshold the whole score map at once and only decode the surviving cells
+	cv::Mat scoreMap(height, width, CV_32F, const_cast<float*>(scores.ptr<float>()));
+	cv::Mat candidates;
+	cv::compare(scoreMap, confidenceThreshold, candidates, cv::CMP_GE);
+	if (cv::countNonZero(candidates) == 0)
+	{
+		return;
+	}
+
+	std::vector<cv::Point> cells;
+	cv::findNonZero(candidates, cells);
+
+	const float* top = geometry.ptr<float>();
+	const float* right = top + planeSize;
+	const float* bottom = right + planeSize;
+	const float* left = bottom + planeSize;
+	const float* angles = left + planeSize;
+
+	const float scaleX = float(frameSize.width) / inputSize.width;
+	const float scaleY = float(frameSize.height) / inputSize.height;
+	const float maxX = static_cast<float>(frameSize.width);
+	const float maxY = static_cast<float>(frameSize.height);
+
+	quads.reserve(quads.size() + cells.size());
+	confidences.reserve(confidences.size() + cells.size());
+
+	for (const cv::Point& cell : cells)
+	{
+		const size_t i = static_cast<size_t>(cell.y) * width + cell.x;
+
+		//Same geometry as OpenCV's EAST decode, the cell offset plus the distances rotated by the predicted angle
+		const float angle = angles[i];
+		const float cosA = std::cos(angle);
+		const float sinA = std::sin(angle);
+		const float h = top[i] + bottom[i];
+		const float w = right[i] + left[i];
+
+		cv::Point2f offset(cell.x * OUTPUT_STRIDE + cosA * right[i] + sinA * bottom[i],
+			cell.y * OUTPUT_STRIDE - sinA * right[i] + cosA * bottom[i]);
+		cv::Point2f p1 = cv::Point2f(-sinA * h, -cosA * h) + offset;
+		cv::Point2f p3 = cv::Point2f(-cosA * w, sinA * w) + offset;
+		cv::RotatedRect box(0.5f * (p1 + p3), cv::Size2f(w, h), static_cast<float>(-angle * 180.0 / CV_PI));
+
+		Quad quad;
+		box.points(quad.data());
+
+		//Rescale to the frame and clamp, done once here so callers get final coordinates
+		for (cv::Point2f& point : quad)
+		{
+			point.x = std::min(std::max(point.x * scaleX, 0.0f), maxX);
+			point.y = std::min(std::max(point.y * scaleY, 0.0f), maxY);
+		}
+
+		quads.push_back(quad);
+		confidences.push_back(scoreMap.at<float>(cell.y, cell.x));
+	}
+}
+
+std::vector<int> EASTDecoder::suppress(const std::vector<Quad>& quads, const std::vector<float>& confidences, float nmsThreshold)
+{
+	std::vector<int> kept;
+	if (quads.empty())
+	{
+		return kept;
+	}
+
+	std::vector<int> order(quads.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&confidences](int a, int b) { return confidences[a] > confidences[b]; });
+
+	std::vector<cv::Rect2f> bounds(quads.size());
+	std::vector<float> areas(quads.size());
+	float maxX = 0, maxY = 0, sizeSum = 0;
+	for (size_t i = 0; i < quads.size(); i++)
+	{
+		float minQuadX = quads[i][0].x, maxQuadX = quads[i][0].x, minQuadY = quads[i][0].y, maxQuadY = quads[i][0].y;
+		for (const cv::Point2f& point : quads[i])
+		{
+			minQuadX = std::min(minQuadX, point.x);
+			maxQuadX = std::max(maxQuadX, point.x);
+			minQuadY = std::min(minQuadY, point.y);
+			maxQuadY = std::max(maxQuadY, point.y);
+		}
+		bounds[i] = cv::Rect2f(minQuadX, minQuadY, maxQuadX - minQuadX, maxQuadY - minQuadY);
+		areas[i] = static_cast<float>(cv::contourArea(cv::Mat(1, 4, CV_32FC2, const_cast<cv::Point2f*>(quads[i].data()))));
+		maxX = std::max(maxX, maxQuadX);
+		maxY = std::max(maxY, maxQuadY);
+		sizeSum += std::max(bounds[i].width, bounds[i].height);
+	}
+
+	//Buckets roughly the size of an average box, so each box only lands in a handful of them
+	const float cellSize = std::max(16.0f, sizeSum / quads.size());
+	const int gridCols = static_cast<int>(maxX / cellSize) + 1;
+	const int gridRows = static_cast<int>(maxY / cellSize) + 1;
+	std::vector<std::vector<int>> grid(static_cast<size_t>(gridCols) * gridRows);
+	std::vector<int> lastCompared(quads.size(), -1);
+
+	auto cellRange = [&](const cv::Rect2f& rect, int& x0, int& y0, int& x1, int& y1)
+		{
+			x0 = std::min(static_cast<int>(rect.x / cellSize), gridCols - 1);
+			y0 = std::min(static_cast<int>(rect.y / cellSize), gridRows - 1);
+			x1 = std::min(static_cast<int>((rect.x + rect.width) / cellSize), gridCols - 1);
+			y1 = std::min(static_cast<int>((rect.y + rect.height) / cellSize), gridRows - 1);
+		};
+
+	for (int candidate : order)
+	{
+		int x0, y0, x1, y1;
+		cellRange(bounds[candidate], x0, y0, x1, y1);
+
+		bool suppressed = false;
+		for (int y = y0; y <= y1 && !suppressed; y++)
+		{
+			for (int x = x0; x <= x1 && !suppressed; x++)
+			{
+				for (int other : grid[static_cast<size_t>(y) * gridCols + x])
+				{
+					//Boxes spanning several buckets are only compared once
+					if (lastCompared[other] == candidate)
+					{
+						continue;
+					}
+					lastCompared[other] = candidate;
+
+					if ((bounds[candidate] & bounds[other]).area() > 0 &&
+						intersectionOverUnion(quads[candidate], quads[other], areas[candidate], areas[other]) > nmsThreshold)
+					{
+						suppressed = true;
+						break;
+					}
+				}
+			}
+		}
+
+		if (!suppressed)
+		{
+			kept.push_back(candidate);
+			for (int y = y0; y <= y1; y++)
+			{
+				for (int x = x0; x <= x1; x++)
+				{
+					grid[static_cast<size_t>(y) * gridCols + x].push_back(candidate);
+				}
+			}
+		}
+	}
+
+	return kept;
+}
+
+std::vector<std::vector<cv::Point>> EASTDecoder::detect(const cv::Mat& scores, const cv::Mat& geometry, float confidenceThreshold, float nmsThreshold,
+	const cv::Size& inputSize, const cv::Size& frameSize)
+{
+	std::vector<Quad> quads;
+	std::vector<float> confidences;
+	decode(scores, geometry, confidenceThreshold, inputSize, frameSize, quads, confidences);
+
+	std::vector<std::vector<cv::Point>> results;
+	for (int index : suppress(quads, confidences, nmsThreshold))
+	{
+		std::vector<cv::Point> points(4);
+		for (int j = 0; j < 4; j++)
+		{
+			points[j] = cv::Point(cvRound(quads[index][j].x), cvRound(quads[index][j].y));
+		}
+		results.push_back(points);
+	}
+
+	return results;
+}
+
+float EASTDecoder::intersectionOverUnion(const Quad& a, const Quad& b, float areaA, float areaB)
+{
+	cv::Mat intersection;
+	float intersectionArea = cv::intersectConvexConvex(cv::Mat(1, 4, CV_32FC2, const_cast<cv::Point2f*>(a.data())),
+		cv::Mat(1, 4, CV_32FC2, const_cast<cv::Point2f*>(b.data())), intersection, true);
+
+	float unionArea = areaA + areaB - intersectionArea;
+	return unionArea <= 0 ? 0 : intersectionArea / unionArea;
+}
+
+}
@@ -0,0 +1,48 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <opencv2/core.hpp>
+#include <array>
+#include <vector>
+
+namespace tik
+{
+
+/// <summary>
+/// Post-processing for the raw outputs of the EAST network, replaces the decode and NMS done inside cv::dnn::TextDetectionModel_EAST
+/// </summary>
+class EASTDecoder
+{
+public:
+	//Corners of a decoded box, same order as cv::RotatedRect::points (bottom left, top left, top right, bottom right)
+	using Quad = std::array<cv::Point2f, 4>;
+
+	/// <summary>
+	/// Decodes the score and geometry maps into quads in frame coordinates, rescaled from the network input and clamped to the frame.
+	/// Cells below the confidence threshold are discarded in bulk before any geometry is decoded.
+	/// </summary>
+	/// <param name="scores">1x1xHxW score map</param>
+	/// <param name="geometry">1x5xHxW geometry map (distances to top, right, bottom and left edges plus angle)</param>
+	static void decode(const cv::Mat& scores, const cv::Mat& geometry, float confidenceThreshold,
+		const cv::Size& inputSize, const cv::Size& frameSize, std::vector<Quad>& quads, std::vector<float>& confidences);
+
+	/// <summary>
+	/// Greedy non maximum suppression over rotated boxes. Kept boxes are bucketed in a grid so each candidate
+	/// is only compared against the boxes it can overlap instead of every box kept so far.
+	/// </summary>
+	/// <returns>Indices of the kept boxes, sorted by descending confidence</returns>
+	static std::vector<int> suppress(const std::vector<Quad>& quads, const std::vector<float>& confidences, float nmsThreshold);
+
+	/// <summary>
+	/// Decodes and suppresses the network outputs, returning integer quads ready to build TextBoxes
+	/// </summary>
+	static std::vector<std::vector<cv::Point>> detect(const cv::Mat& scores, const cv::Mat& geometry, float confidenceThreshold, float nmsThreshold,
+		const cv::Size& inputSize, const cv::Size& frameSize);
+
+private:
+	static float intersectionOverUnion(const Quad& a, const Quad& b, float areaA, float areaB);
+
+	static const int OUTPUT_STRIDE = 4; //Each cell of the output maps covers 4x4 input pixels
+};
+
+}
@@ -11,27 +11,196 @@
 #include "SizeChecker.hpp"
 #include "ContrastChecker.hpp"
 #include "TextBoxRecognitionOpenCV.hpp"
+#include "ModelRegistry.hpp"
+#include "TextPrefilter.hpp"
+#include "BoxCache.hpp"
+#include "DetectionCache.hpp"
+#include "ContentHash.hpp"
+#include "AnalysisContext.hpp"
+#include "Video.hpp"
+#include "ThreadBudget.hpp"
 
+#include <chrono>
+#include <future>
 
 namespace tik
 {
 
-void Fonttik::init(Configuration* config)
+void Fonttik::init(const Configuration* config)
 {
+	using Clock = std::chrono::steady_clock;
+	auto elapsedMs = [](Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+	Clock::time_point initStart = Clock::now();
+
 	configuration = config;
 
-	textBoxDetection = OCRFactory::CreateTextboxDetection(configuration->getTextDetectionBackend(), configuration->getTextDetectionParams(), config->getSbgrValues());
-	
-	if (configuration->getTextSizeParams().useTextRecognition)
+	//Networks belong to this instance rather than to the thread calling init, it may run on other threads later
+	inferenceContext = ModelRegistry::createContext();
+	ModelRegistry::ContextScope scope(inferenceContext);
+
+	const PerformanceParams& performanceParams = configuration->getPerformanceParams();
+	ThreadBudget::getInstance().configure(performanceParams.threadBudget, performanceParams.pinThreads);
+	const cv::Size warmUpSize(performanceParams.warmUpResolution[0], performanceParams.warmUpResolution[1]);
+	const bool useTextRecognition = configuration->getTextSizeParams().useTextRecognition;
+
+	initStats = InitStats();
+	double& detectionLoadMs = initStats.detectionLoadMs;
+	double& detectionWarmUpMs = initStats.detectionWarmUpMs;
+	double& recognitionLoadMs = initStats.recognitionLoadMs;
+	double& recognitionWarmUpMs = initStats.recognitionWarmUpMs;
+
+	auto loadDetection = [&]()
+		{
+			Clock::time_point start = Clock::now();
+			textBoxDetection = OCRFactory::CreateTextboxDetection(configuration->getTextDetectionBackend(), configuration->getTextDetectionParams(), config->getSbgrValues());
+			detectionLoadMs = elapsedMs(start);
+
+			if (textBoxDetection != nullptr && performanceParams.warmUpModels)
+			{
+				start = Clock::now();
+				textBoxDetection->warmUp(warmUpSize);
+				detectionWarmUpMs = elapsedMs(start);
+			}
+		};
+
+	auto loadRecognition = [&]()
+		{
+			Clock::time_point start = Clock::now();
+			textBoxRecognition = OCRFactory::CreateTextboxRecognition(configuration->getTextRecognitionParams());
+			recognitionLoadMs = elapsedMs(start);
+
+			if (textBoxRecognition != nullptr && performanceParams.warmUpModels)
+			{
+				start = Clock::now();
+				textBoxRecognition->warmUp();
+				recognitionWarmUpMs = elapsedMs(start);
+			}
+		};
+
+	//Recognition is only created when enabled, it will be created on demand if OCR is enabled later on
+	if (useTextRecognition && performanceParams.parallelModelLoading)
 	{
-		textBoxRecognition = OCRFactory::CreateTextboxRecognition(configuration->getTextRecognitionParams());
+		std::future<void> recognitionTask = std::async(std::launch::async, [&]()
+			{
+				ModelRegistry::ContextScope scope(inferenceContext);
+				loadRecognition();
+			});
+		loadDetection();
+		recognitionTask.get();
+	}
+	else
+	{
+		loadDetection();
+		if (useTextRecognition)
+		{
+			loadRecognition();
+		}
 	}
 
 	//Create checkers
 	contrastChecker = new ContrastChecker(config);
 	sizeChecker = new SizeChecker(config, textBoxRecognition);
 
-	colorblindFilters = new ColorblindFilters(config);
+	if (performanceParams.textPrefilter)
+	{
+		textPrefilter = new TextPrefilter(performanceParams);
+	}
+
+	if (performanceParams.boxCache)
+	{
+		boxCache = new BoxCache(config, performanceParams);
+	}
+
+	//Rekognition boxes carry their text, which isn't kept in the cache
+	if (performanceParams.detectionCache && configuration->getTextDetectionBackend() != Configuration::DetectionBackend::DB_Rekognition)
+	{
+		detectionCache = DetectionCache::open(performanceParams.detectionCachePath);
+		sizeChecker->setDetectionCache(detectionCache, configuration->getRecognitionHash());
+	}
+
+	getColorblindFilters();
+
+	initStats.totalMs = elapsedMs(initStart);
+	LOG_CORE_INFO("Fonttik initialized in {:.1f}ms (detection: load {:.1f}ms, warm-up {:.1f}ms | recognition: load {:.1f}ms, warm-up {:.1f}ms)",
+		initStats.totalMs, detectionLoadMs, detectionWarmUpMs, recognitionLoadMs, recognitionWarmUpMs);
+}
+
+void Fonttik::initTextRecognition()
+{
+	if (textBoxRecognition == nullptr && configuration->getTextSizeParams().useTextRecognition)
+	{
+		LOG_CORE_DEBUG("Text recognition enabled after init, loading recognition model");
+		ModelRegistry::ContextScope scope(inferenceContext);
+		textBoxRecognition = OCRFactory::CreateTextboxRecognition(configuration->getTextRecognitionParams());
+		sizeChecker->setTextboxRecognition(textBoxRecognition);
+	}
+}
+
+void Fonttik::beginAnalysis(const SizeGuidelines& guideline)
+{
+	if (analysisContext != nullptr)
+	{
+		delete analysisContext;
+	}
+	analysisContext = new AnalysisContext(configuration->getPerformanceParams(), guideline);
+
+	sizeChecker->setGuideline(&analysisContext->guideline);
+	if (boxCache != nullptr)
+	{
+		boxCache->setGuideline(&analysisContext->guideline);
+	}
+}
+
+ColorblindFilters* Fonttik::getColorblindFilters()
+{
+	if (colorblindFilters == nullptr && configuration->getAppSettings().useColorblindFilters)
+	{
+		colorblindFilters = new ColorblindFilters(configuration);
+	}
+	return colorblindFilters;
+}
+
+Metrics Fonttik::getMetrics() const
+{
+	Metrics metrics;
+	metrics.init = initStats;
+	metrics.init.detectionLoaded = textBoxDetection != nullptr;
+	metrics.init.recognitionLoaded = textBoxRecognition != nullptr;
+	if (textBoxDetection != nullptr)
+	{
+		metrics.detectionInputCache = textBoxDetection->getInputCacheStats();
+	}
+	if (textPrefilter != nullptr)
+	{
+		metrics.prefilter = textPrefilter->getStats();
+	}
+	if (boxCache != nullptr)
+	{
+		metrics.boxCache = boxCache->getStats();
+		metrics.boxCacheMemory = boxCache->getMemoryUsage();
+	}
+	if (detectionCache != nullptr)
+	{
+		metrics.persistentDetections = detectionCache->getDetectionStats();
+		metrics.persistentRecognitions = detectionCache->getTextStats();
+	}
+	if (analysisContext != nullptr && analysisContext->hudLayout != nullptr)
+	{
+		metrics.hudLayout = analysisContext->hudLayout->getStats();
+	}
+	if (analysisContext != nullptr && analysisContext->incremental != nullptr)
+	{
+		metrics.incremental = analysisContext->incremental->getStats();
+	}
+	if (analysisContext != nullptr && analysisContext->tracker != nullptr)
+	{
+		metrics.tracking = analysisContext->tracker->getStats();
+	}
+	if (analysisContext != nullptr && analysisContext->realTime != nullptr)
+	{
+		metrics.realTime = analysisContext->realTime->getStats();
+	}
+	return metrics;
 }
 
 std::pair<fs::path, fs::path> Fonttik::saveResults(Media& media, Results& results)
@@ -48,6 +217,50 @@ std::pair<fs::path, fs::path> Fonttik::saveResults(Media& media, Results& result
 	);
 }
 
+//JSON of a frame's results as stored in the results files, contrast results also carry their colorblind values
+static json frameResultsToJson(const FrameResults& frame, bool contrast)
+{
+	json jFrame = json();
+	jFrame["id"] = (frame.frame);
+	if (frame.degradedStages != DEGRADED_NONE)
+	{
+		jFrame["degraded"] = tik::DegradedStagesAsStrings(frame.degradedStages);
+	}
+	jFrame["results"] = json::array();
+
+	for (auto res : frame.results)
+	{
+		json jResult = json();
+		jResult["type"] = tik::ResultTypeAsString(res.type);
+		jResult["x"] = res.x;
+		jResult["y"] = res.y;
+		jResult["width"] = res.width;
+		jResult["height"] = res.height;
+		jResult["value"] = res.value;
+		jResult["text"] = res.text;
+		if (res.trackId >= 0)
+		{
+			jResult["trackId"] = res.trackId;
+		}
+
+		if (contrast && !res.colorblindValues.empty())
+		{
+			jResult["protanValue"] = res.colorblindValues[0];
+			jResult["protanType"] = tik::ResultTypeAsString(res.colorblindTypes[0]);
+			jResult["deutanValue"] = res.colorblindValues[1];
+			jResult["deutanType"] = tik::ResultTypeAsString(res.colorblindTypes[1]);
+			jResult["tritanValue"] = res.colorblindValues[2];
+			jResult["tritanType"] = tik::ResultTypeAsString(res.colorblindTypes[2]);
+			jResult["grayscaleValue"] = res.colorblindValues[3];
+			jResult["grayscaleType"] = tik::ResultTypeAsString(res.colorblindTypes[3]);
+		}
+
+		jFrame["results"].push_back(jResult);
+	}
+
+	return jFrame;
+}
+
 std::pair<fs::path, fs::path> Fonttik::saveResultsToJson(fs::path outputPath, Results& results)
 {
 	fs::path outputSize = outputPath / "sizeChecks.json";
@@ -59,37 +272,7 @@ std::pair<fs::path, fs::path> Fonttik::saveResultsToJson(fs::path outputPath, Re
 			jResults = json::array();
 			for (auto frame : results)
 			{
-				json jFrame = json();
-				jFrame["id"] = (frame.frame);
-				jFrame["results"] = json::array();
-
-				for (auto res : frame.results)
-				{
-					json jResult = json();
-					jResult["type"] = tik::ResultTypeAsString(res.type);
-					jResult["x"] = res.x;
-					jResult["y"] = res.y;
-					jResult["width"] = res.width;
-					jResult["height"] = res.height;
-					jResult["value"] = res.value;
-					jResult["text"] = res.text;
-
-					if (path.stem() == "contrastChecks" && !res.colorblindValues.empty())
-					{
-						jResult["protanValue"] = res.colorblindValues[0];
-						jResult["protanType"] = tik::ResultTypeAsString(res.colorblindTypes[0]);
-						jResult["deutanValue"] = res.colorblindValues[1];
-						jResult["deutanType"] = tik::ResultTypeAsString(res.colorblindTypes[1]);
-						jResult["tritanValue"] = res.colorblindValues[2];
-						jResult["tritanType"] = tik::ResultTypeAsString(res.colorblindTypes[2]);
-						jResult["grayscaleValue"] = res.colorblindValues[3];
-						jResult["grayscaleType"] = tik::ResultTypeAsString(res.colorblindTypes[3]);
-					}
-
-					jFrame["results"].push_back(jResult);
-				}
-
-				jResults.push_back(jFrame);
+				jResults.push_back(frameResultsToJson(frame, path.stem() == "contrastChecks"));
 			}
 			std::ofstream out(path);
 			out << jResults.dump();
@@ -101,17 +284,32 @@ std::pair<fs::path, fs::path> Fonttik::saveResultsToJson(fs::path outputPath, Re
 	return { outputSize, outputContrast };
 }
 
+void Fonttik::writeResultsLine(std::ostream& out, const std::pair<FrameResults, FrameResults>& results)
+{
+	json jSize = frameResultsToJson(results.first, false);
+	json jContrast = frameResultsToJson(results.second, true);
+
+	json jLine = json();
+	jLine["id"] = results.first.frame;
+	if (results.first.degradedStages != DEGRADED_NONE)
+	{
+		jLine["degraded"] = jSize["degraded"];
+	}
+	jLine["size"] = { {"type", tik::ResultTypeAsString(results.first.overallType)}, {"results", jSize["results"]} };
+	jLine["contrast"] = { {"type", tik::ResultTypeAsString(results.second.overallType)}, {"results", jContrast["results"]} };
+
+	//Flushed line by line so whoever reads the stream sees each frame as soon as it's analysed
+	out << jLine.dump() << '\n';
+	out.flush();
+}
+
 AsyncResults tik::Fonttik::processMediaAsync(Media& media)
 {
-	if (!setResolutionGuideline(media))
+	if (!beginMedia(media))
 	{
 		throw std::runtime_error("Media resolution not supported");
 	}
 
-	Results results;
-	media.calculateMask(configuration->getMaskParams());
-	media.setAnalysisWaitSeconds(configuration->getAppSettings().analysisWaitSeconds);
-
 	rigtorp::SPSCQueue<FrameResult> queue(10);
 	std::atomic<bool> done = false;
 
@@ -130,10 +328,17 @@ AsyncResults tik::Fonttik::processMediaAsync(Media& media)
 	//Process each frame and add received frame's results to the media results
 	while (media.loadFrame()) 
 	{
+		const auto started = std::chrono::steady_clock::now();
 		Frame frame = media.getFrame();
-		auto colorblindFrames = media.getColorblindFrames();
-		std::pair<FrameResults, FrameResults> res = processFrame(frame, colorblindFrames, configuration->getAppSettings().sizeByLine);
+		std::pair<FrameResults, FrameResults> res = processFrame(frame, loadColorblindFrames(media), configuration->getAppSettings().sizeByLine,
+			started);
+		keepUpWith(media);
 		FrameResult frameResult{ res.first, res.second, count++, frame.getTimeStamp() };
+		if (!media.framesOutliveAnalysis())
+		{
+			//Copied before the next frame is loaded over it
+			frameResult.frame = frame.getFrameMat().clone();
+		}
 		while (!queue.try_push(frameResult)) {}; //Busy wait for results to be consumed
 		result.overAllPassSize = result.overAllPassSize && res.first.overallPass;
 		result.overAllResultSize = ResultTypeMerge(result.overAllResultSize, res.first.overallType);
@@ -157,41 +362,274 @@ AsyncResults tik::Fonttik::processMediaAsync(Media& media)
 	result.pathToJSONSizeResult = media.getOutputPath() / fs::path{ std::string("sizeChecks.json") };
 	result.pathToJSONContrastResult = media.getOutputPath() / fs::path{ std::string("contrastChecks.json") };
 
+	//Not every media writes every output, e.g. colorblind images or outlines stored per frame
+	for (fs::path* path : { &result.pathToSizeResult, &result.pathToContrastResult, &result.pathToProtanResult, &result.pathToDeutanResult,
+		&result.pathToTritanResult, &result.pathToGrayscaleResult, &result.pathToJSONSizeResult, &result.pathToJSONContrastResult })
+	{
+		if (!fs::exists(*path))
+		{
+			path->clear();
+		}
+	}
+
 	return result;
 
 }
 
+bool Fonttik::beginMedia(Media& media)
+{
+	const SizeGuidelines* guideline = findResolutionGuideline(media);
+	if (guideline == nullptr)
+	{
+		return false;
+	}
+
+	initTextRecognition();
+	beginAnalysis(*guideline);
+
+	media.calculateMask(configuration->getMaskParams());
+	media.setAnalysisWaitSeconds(configuration->getAppSettings().analysisWaitSeconds);
+	media.setAutoCrop(configuration->getPerformanceParams().autoCropBorders, configuration->getPerformanceParams().borderThreshold);
+
+	//Real-time mode only degrades the stages this media runs
+	if (analysisContext->realTime != nullptr)
+	{
+		unsigned stages = DEGRADED_DETECTION;
+		stages |= media.producesColorblindFrames() ? DEGRADED_COLORBLIND : DEGRADED_NONE;
+		stages |= (textBoxRecognition != nullptr && configuration->getTextSizeParams().useTextRecognition) ? DEGRADED_RECOGNITION : DEGRADED_NONE;
+		analysisContext->realTime->setAvailableStages(stages);
+	}
+	return true;
+}
+
+std::pair<FrameResults, FrameResults> Fonttik::processFrame(Media& media)
+{
+	if (analysisContext == nullptr)
+	{
+		throw std::runtime_error("beginMedia must be called before processing frames of a media");
+	}
+
+	//Real-time mode times the whole frame, including copying it and filtering it for colorblindness
+	const auto started = std::chrono::steady_clock::now();
+	Frame frame = media.getFrame();
+	std::pair<FrameResults, FrameResults> results = processFrame(frame, loadColorblindFrames(media), configuration->getAppSettings().sizeByLine,
+		started);
+	keepUpWith(media);
+	return results;
+}
+
+std::vector<Frame> Fonttik::loadColorblindFrames(Media& media)
+{
+	//The plan doesn't change until the frame is finished, so it's the one processFrame will follow
+	RealTimeController* realTime = (analysisContext != nullptr) ? analysisContext->realTime.get() : nullptr;
+	if (realTime != nullptr && (realTime->planFrame() & DEGRADED_COLORBLIND))
+	{
+		return {};
+	}
+	return media.getColorblindFrames();
+}
+
 Results Fonttik::processMedia(Media& media)
 {
-	if (!setResolutionGuideline(media)){
+	if (!beginMedia(media))
+	{
 		return {};
 	}
 
 	Results results;
-	media.calculateMask(configuration->getMaskParams());
-	media.setAnalysisWaitSeconds(configuration->getAppSettings().analysisWaitSeconds);
 
-	while (media.loadFrame()){
-		auto frame = media.getFrame();
-		auto colorblindFrames = media.getColorblindFrames();
-		std::pair<FrameResults, FrameResults> res = processFrame(frame, colorblindFrames, configuration->getAppSettings().sizeByLine);
+	//Long videos can be split into segments analysed concurrently. Real-time analysis follows a single playback, and HUD layout,
+	//incremental analysis and box tracking carry state from frame to frame that segments can't reproduce
+	Video* video = dynamic_cast<Video*>(&media);
+	const PerformanceParams& performanceParams = configuration->getPerformanceParams();
+	const bool split = video != nullptr && analysisContext->realTime == nullptr && !performanceParams.hudLayout &&
+		!performanceParams.incrementalAnalysis && !performanceParams.boxTracking;
+	ThreadBudget::Lease segments = ThreadBudget::getInstance().acquire(split ? getVideoSegmentCount(*video) : 1);
+	if (segments.size() > 1)
+	{
+		results = processVideoSegments(*video, segments.size());
+	}
+
+	while (segments.size() == 1 && media.loadFrame()){
+		std::pair<FrameResults, FrameResults> res = processFrame(media);
 		
 		results.addSizeResults(res.first);
 		results.addContrastResults(res.second);
 	}
 
+	CacheStats inputCache = textBoxDetection->getInputCacheStats();
+	LOG_CORE_DEBUG("Detection input cache: {} hits, {} misses, {} evictions", inputCache.hits, inputCache.misses, inputCache.evictions);
+	if (textPrefilter != nullptr)
+	{
+		PrefilterStats prefilterStats = textPrefilter->getStats();
+		LOG_CORE_DEBUG("Prefilter skipped detection on {} of {} frames", prefilterStats.framesSkipped, prefilterStats.framesEvaluated);
+	}
+	if (boxCache != nullptr)
+	{
+		LOG_CORE_DEBUG("Box cache: {:.1f}% hit rate, {} bytes in use", 100.0 * boxCache->getStats().hitRate(), boxCache->getMemoryUsage());
+	}
+
 	LOG_CORE_TRACE("SIZE CHECK RESULT: {0}", (results.sizePass() ? "PASS" : "FAIL"));
 	LOG_CORE_TRACE("CONTRAST CHECK RESULT: {0}", (results.contrastPass() ? "PASS" : "FAIL"));
 		
 	return results;
 }
 
+int Fonttik::getVideoSegmentCount(Video& video)
+{
+	int segments = configuration->getPerformanceParams().videoSegments;
+	if (segments == 1)
+	{
+		return 1;
+	}
+	if (segments <= 0)
+	{
+		segments = ThreadBudget::getInstance().getThreads();
+	}
+
+	//Streams don't report their length and can't be split
+	int frames = video.getFrameCount() - video.getStartFrame();
+	return std::max(1, std::min(segments, frames / MIN_SEGMENT_FRAMES));
+}
+
+Results Fonttik::processVideoSegments(Video& video, int segments)
+{
+	const int startFrame = video.getStartFrame();
+	const int frameCount = video.getFrameCount();
+	LOG_CORE_INFO("Analysing {0} in {1} segments", video.getPath().string(), segments);
+
+	//Without similar frames a sequential run analyses every step frames from the start, segments start on those frames so their
+	//selection usually lines up with the sequential one right away
+	const int step = std::max(video.getFramesToSkip() - 1, 1);
+	std::vector<std::unique_ptr<Video>> segmentVideos;
+	std::vector<int> segmentEnds;
+	for (int i = 0; i < segments; i++)
+	{
+		int first = startFrame + int((int64_t(frameCount - startFrame) * i) / segments) / step * step;
+		int end = (i + 1 < segments) ? startFrame + int((int64_t(frameCount - startFrame) * (i + 1)) / segments) / step * step : INT_MAX;
+		segmentVideos.push_back(std::make_unique<Video>(video.getPath().string()));
+		segmentVideos.back()->setFrameRange(first, end);
+		segmentEnds.push_back(end);
+	}
+
+	//Segment instances are kept for the next videos, each one has its own inference context so its networks stay its own
+	//whichever thread runs it
+	segmentFonttiks.resize(std::max(segmentFonttiks.size(), size_t(segments)));
+
+	//Results of every analysed frame of each segment, in order
+	std::vector<std::vector<std::pair<int, std::pair<FrameResults, FrameResults>>>> analysed(segments);
+	std::vector<std::exception_ptr> errors(segments);
+	const SizeGuidelines guideline = analysisContext->guideline;
+	const int waitSeconds = configuration->getAppSettings().analysisWaitSeconds;
+	std::vector<std::thread> workers;
+	for (int i = 0; i < segments; i++)
+	{
+		workers.emplace_back([this, i, &guideline, waitSeconds, &segmentVideos, &analysed, &errors]()
+			{
+				ThreadBudget::getInstance().pinCurrentThread();
+				try
+				{
+					//Each segment has its own networks and per media state, the configuration is shared
+					if (segmentFonttiks[i] == nullptr)
+					{
+						segmentFonttiks[i] = std::make_unique<Fonttik>(configuration);
+					}
+					Fonttik& segmentFonttik = *segmentFonttiks[i];
+					Video& segment = *segmentVideos[i];
+					segmentFonttik.beginAnalysis(guideline);
+					segment.calculateMask(configuration->getMaskParams());
+					segment.setAnalysisWaitSeconds(waitSeconds);
+					segment.setAutoCrop(configuration->getPerformanceParams().autoCropBorders, configuration->getPerformanceParams().borderThreshold);
+
+					while (segment.loadFrame())
+					{
+						Frame frame = segment.getFrame();
+						analysed[i].push_back({ frame.getFrameIndex(),
+							segmentFonttik.processFrame(frame, segment.getColorblindFrames(), configuration->getAppSettings().sizeByLine) });
+					}
+				}
+				catch (...)
+				{
+					errors[i] = std::current_exception();
+				}
+			});
+	}
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+	for (const std::exception_ptr& error : errors)
+	{
+		if (error != nullptr)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+
+	//A segment selects its frames starting from its own first frame, a sequential run from the last frame analysed before it.
+	//The next frame only depends on the last analysed one, so once both pick the same frame they pick the same ones after it.
+	//Until then the sequential selection is replayed from the last analysed frame and its frames are analysed here
+	Results results;
+	int lastAnalysed = -1;
+	for (int i = 0; i < segments; i++)
+	{
+		size_t first = 0;
+		if (lastAnalysed >= 0)
+		{
+			Video catchUp(video.getPath().string());
+			catchUp.setFrameRange(lastAnalysed, segmentEnds[i]);
+			catchUp.calculateMask(configuration->getMaskParams());
+			catchUp.setAnalysisWaitSeconds(waitSeconds);
+			catchUp.setAutoCrop(configuration->getPerformanceParams().autoCropBorders, configuration->getPerformanceParams().borderThreshold);
+
+			//Loads the last analysed frame, the next ones are compared against it
+			catchUp.loadFrame();
+			first = analysed[i].size();
+			while (catchUp.loadFrame())
+			{
+				Frame frame = catchUp.getFrame();
+				size_t next = 0;
+				while (next < analysed[i].size() && analysed[i][next].first < frame.getFrameIndex())
+				{
+					next++;
+				}
+				if (next < analysed[i].size() && analysed[i][next].first == frame.getFrameIndex())
+				{
+					first = next;
+					break;
+				}
+
+				LOG_CORE_DEBUG("Analysing frame {0}, skipped by segment {1}", frame.getFrameIndex(), i);
+				std::pair<FrameResults, FrameResults> frameResults = processFrame(frame, catchUp.getColorblindFrames(),
+					configuration->getAppSettings().sizeByLine);
+				results.addSizeResults(frameResults.first);
+				results.addContrastResults(frameResults.second);
+				lastAnalysed = frame.getFrameIndex();
+			}
+
+			if (first > 0)
+			{
+				LOG_CORE_DEBUG("Dropping {0} frames at the start of segment {1} a sequential analysis wouldn't pick", first, i);
+			}
+		}
+
+		for (size_t j = first; j < analysed[i].size(); j++)
+		{
+			results.addSizeResults(analysed[i][j].second.first);
+			results.addContrastResults(analysed[i][j].second.second);
+			lastAnalysed = analysed[i][j].first;
+		}
+	}
+
+	return results;
+}
+
 std::vector< std::vector<tik::TextBox>> Fonttik::createColorblindTextBoxes(std::vector<Frame> colorblindFrames, std::vector<tik::TextBox> words) {
 	std::vector< std::vector<tik::TextBox>> colorblindWords;
 	for (auto tb : words) {
 		std::vector<tik::TextBox> colorblindTypeWords;
 		for (auto frame : colorblindFrames) {
-			colorblindTypeWords.push_back(TextBox(tb.getTextBoxRect(), frame.getFrameMat()));
+			colorblindTypeWords.push_back(TextBox(tb.getTextBoxRect(), frame.getContentMat()));
 		}
 		calculateTextBoxLuminance(colorblindTypeWords);
 		calculateTextMasks(colorblindTypeWords);
@@ -203,54 +641,265 @@ std::vector< std::vector<tik::TextBox>> Fonttik::createColorblindTextBoxes(std::
 
 std::pair<FrameResults, FrameResults> Fonttik::processFrame(Frame& frame, std::vector<Frame> colorblindFrames, bool sizeByLine)
 {
+	return processFrame(frame, colorblindFrames, sizeByLine, std::chrono::steady_clock::now());
+}
+
+std::pair<FrameResults, FrameResults> Fonttik::processFrame(Frame& frame, std::vector<Frame> colorblindFrames, bool sizeByLine,
+	std::chrono::steady_clock::time_point started)
+{
+	RealTimeController* realTime = (analysisContext != nullptr) ? analysisContext->realTime.get() : nullptr;
+	if (realTime == nullptr)
+	{
+		return analyseFrame(frame, colorblindFrames, sizeByLine);
+	}
+
+	//Results measured with other stages are never carried over, tracking and incremental analysis start over when they change
+	const unsigned degraded = realTime->planFrame();
+	if (degraded != analysisContext->degradedStages)
+	{
+		if (analysisContext->incremental != nullptr)
+		{
+			analysisContext->incremental->reset();
+		}
+		if (analysisContext->tracker != nullptr)
+		{
+			analysisContext->tracker->reset();
+		}
+		analysisContext->degradedStages = degraded;
+	}
+
+	if (degraded & DEGRADED_COLORBLIND)
+	{
+		colorblindFrames.clear();
+	}
+	sizeChecker->setRecognitionEnabled(!(degraded & DEGRADED_RECOGNITION));
+	textBoxDetection->setInputScale((degraded & DEGRADED_DETECTION) ? configuration->getPerformanceParams().realTimeDetectionScale : 1.0);
+	if (boxCache != nullptr)
+	{
+		boxCache->setDegradedStages(degraded);
+	}
+
+	std::pair<FrameResults, FrameResults> results = analyseFrame(frame, colorblindFrames, sizeByLine);
+
+	sizeChecker->setRecognitionEnabled(true);
+	textBoxDetection->setInputScale(1.0);
+	if (boxCache != nullptr)
+	{
+		boxCache->setDegradedStages(DEGRADED_NONE);
+	}
+
+	results.first.degradedStages = degraded;
+	results.second.degradedStages = degraded;
+	realTime->frameFinished(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count());
+	return results;
+}
+
+void Fonttik::keepUpWith(Media& media)
+{
+	if (analysisContext != nullptr && analysisContext->realTime != nullptr)
+	{
+		auto elapsed = std::chrono::steady_clock::now() - analysisContext->started;
+		media.setPlaybackPosition(static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+	}
+}
+
+std::pair<FrameResults, FrameResults> Fonttik::analyseFrame(Frame& frame, std::vector<Frame> colorblindFrames, bool sizeByLine)
+{
+	//Detectors create their networks on first use, they must come from this instance's context
+	ModelRegistry::ContextScope scope(inferenceContext);
+
 	//TODO:: Add condition on whether we are grouping by line or not for text size
 	std::vector<tik::TextBox> words;
 	std::vector<tik::TextBox> lines;
 
-	if (sizeByLine)
+	FrameResults sizeResults(-1);
+	FrameResults contrastResults(-1);
+
+	//Analysis runs inside the letterbox borders if any were found, results are moved back to frame coordinates at the end
+	cv::Mat content = frame.getContentMat();
+
+	IncrementalAnalysis* incremental = (analysisContext != nullptr) ? analysisContext->incremental.get() : nullptr;
+
+	if (textPrefilter != nullptr && !textPrefilter->hasText(content))
 	{
-		auto textBoxes = textBoxDetection->detectLinesAndWords(frame.getFrameMat());
-		words = textBoxes.words;
-		lines = textBoxes.lines.empty()?textBoxes.words:textBoxes.lines;
+		if (incremental != nullptr)
+		{
+			incremental->reset();
+		}
+		return { sizeResults, contrastResults };
 	}
-	else
+
+	//Once the HUD layout is learned most frames are only detected inside it
+	HudLayout* hudLayout = (analysisContext != nullptr) ? analysisContext->hudLayout.get() : nullptr;
+	HudLayout::Plan plan = (hudLayout != nullptr) ? hudLayout->planFrame(content.size()) : HudLayout::Plan{};
+
+	if (!plan.fullScan && plan.regions.empty())
 	{
-		words = textBoxDetection->detectBoxes(frame.getFrameMat());
-		lines = words;
+		LOG_CORE_DEBUG("HUD layout has no text regions, skipping detection until the next full scan");
+		return { sizeResults, contrastResults };
 	}
 
-	FrameResults sizeResults(-1);
-	FrameResults contrastResults(-1);
+	//Incremental analysis only redoes the regions that changed since the previous analysed frame, HUD full scans always run whole
+	IncrementalAnalysis::Update update = (incremental != nullptr && !(hudLayout != nullptr && plan.fullScan)) ?
+		incremental->findChanges(content) : IncrementalAnalysis::Update{};
 
-	if (words.empty())
+	bool fullDetection = plan.fullScan && update.full;
+	std::vector<cv::Rect> regions = update.full ? plan.regions : update.regions;
+	if (!plan.fullScan && !update.full)
+	{
+		regions.clear();
+		for (const cv::Rect& changed : update.regions)
+		{
+			for (const cv::Rect& hud : plan.regions)
+			{
+				if ((changed & hud).area() > 0)
+				{
+					regions.push_back(changed & hud);
+				}
+			}
+		}
+	}
+
+	//Whole frame detections are replayed from the detection cache when the same frame was detected with the same settings before
+	uint64_t frameHash = 0;
+	const double inputScale = textBoxDetection->getInputScale();
+	const uint64_t detectionHash = hashBytes(&inputScale, sizeof(inputScale), hashBytes(&sizeByLine, sizeof(sizeByLine), configuration->getDetectionHash()));
+	std::optional<DetectionCache::Detection> cachedDetection;
+	if (fullDetection && detectionCache != nullptr)
+	{
+		frameHash = hashPixels(content);
+		cachedDetection = detectionCache->getDetection(frameHash, detectionHash);
+	}
+
+	if (cachedDetection.has_value())
+	{
+		for (const cv::Rect& rect : cachedDetection->words)
+		{
+			words.push_back(TextBox(rect, content));
+		}
+		for (const cv::Rect& rect : cachedDetection->lines)
+		{
+			lines.push_back(TextBox(rect, content));
+		}
+	}
+	else if (fullDetection || !regions.empty())
+	{
+		//HUD regions keep their size until the next layout scan, regions that changed since the last frame don't
+		const bool fixedRegions = update.full;
+		if (sizeByLine)
+		{
+			auto textBoxes = fullDetection ? textBoxDetection->detectLinesAndWords(content) :
+				textBoxDetection->detectLinesAndWordsInRegions(content, regions, fixedRegions);
+			words = textBoxes.words;
+			lines = textBoxes.lines.empty()?textBoxes.words:textBoxes.lines;
+		}
+		else
+		{
+			words = fullDetection ? textBoxDetection->detectBoxes(content) : textBoxDetection->detectBoxesInRegions(content, regions, fixedRegions);
+			lines = words;
+		}
+
+		if (fullDetection && detectionCache != nullptr)
+		{
+			DetectionCache::Detection detection;
+			for (const TextBox& word : words)
+			{
+				detection.words.push_back(word.getTextBoxRect());
+			}
+			for (const TextBox& line : lines)
+			{
+				detection.lines.push_back(line.getTextBoxRect());
+			}
+			detectionCache->putDetection(frameHash, detectionHash, detection);
+		}
+	}
+
+	if (hudLayout != nullptr && plan.fullScan)
+	{
+		std::vector<cv::Rect> wordRects;
+		for (const TextBox& word : words)
+		{
+			wordRects.push_back(word.getTextBoxRect());
+		}
+		hudLayout->addDetections(wordRects);
+	}
+
+	if (words.empty() && update.full)
 	{
 		LOG_CORE_INFO("No words detected in image");
-		return { sizeResults, contrastResults };
+		if (incremental == nullptr)
+		{
+			return { sizeResults, contrastResults };
+		}
 	}
 
-	textBoxDetection->mergeTextBoxes(words, frame.getFrameMat());
-	textBoxDetection->mergeTextBoxes(lines, frame.getFrameMat());
-	
-	calculateTextBoxLuminance(words);
-	calculateTextBoxLuminance(lines);
+	if (!words.empty())
+	{
+		textBoxDetection->mergeTextBoxes(words, content);
+		textBoxDetection->mergeTextBoxes(lines, content);
+
+		//Tracked boxes whose pixels didn't change keep their previous results and skip the checks
+		BoxTracker* tracker = (analysisContext != nullptr) ? analysisContext->tracker.get() : nullptr;
+		if (tracker != nullptr)
+		{
+			words = tracker->match(words, CONTRAST_CHECK);
+			lines = tracker->match(lines, SIZE_CHECK);
+		}
+
+		//Boxes already seen anywhere else reuse their cached results
+		if (boxCache != nullptr)
+		{
+			words = boxCache->match(words, CONTRAST_CHECK, !colorblindFrames.empty());
+			lines = boxCache->match(lines, SIZE_CHECK, !colorblindFrames.empty());
+		}
+
+		calculateTextBoxLuminance(words);
+		calculateTextBoxLuminance(lines);
+
+		calculateTextMasks(words);
+		calculateTextMasks(lines);
+
+		std::vector< std::vector<tik::TextBox>> colorblindWords = {};
+		if (!colorblindFrames.empty()) {
+			colorblindWords = createColorblindTextBoxes(colorblindFrames, words);
+		}
+
+		contrastResults = contrastChecker->check(frame.getFrameIndex(), words, colorblindWords);
+		sizeResults = sizeChecker->check(frame.getFrameIndex(), lines);
+
+		if (boxCache != nullptr)
+		{
+			boxCache->complete(contrastResults, CONTRAST_CHECK);
+			boxCache->complete(sizeResults, SIZE_CHECK);
+		}
 
-	calculateTextMasks(words);
-	calculateTextMasks(lines);
+		if (tracker != nullptr)
+		{
+			tracker->complete(contrastResults, CONTRAST_CHECK);
+			tracker->complete(sizeResults, SIZE_CHECK);
+		}
 
-	std::vector< std::vector<tik::TextBox>> colorblindWords = {};
-	if (!colorblindFrames.empty()) {
-		colorblindWords = createColorblindTextBoxes(colorblindFrames, words);
+		setTextInContrastResults(sizeResults, contrastResults);
 	}
 
-	contrastResults = contrastChecker->check(frame.getFrameIndex(), words, colorblindWords);
-	sizeResults = sizeChecker->check(frame.getFrameIndex(), lines);
+	if (incremental != nullptr)
+	{
+		sizeResults.frame = frame.getFrameIndex();
+		contrastResults.frame = frame.getFrameIndex();
+		if (!update.full)
+		{
+			incremental->carryOver(update.regions, sizeResults, contrastResults);
+		}
+		incremental->store(content, sizeResults, contrastResults);
+	}
 
-	setTextInContrastResults(sizeResults, contrastResults);
+	offsetResults(sizeResults, frame.getContentOffset());
+	offsetResults(contrastResults, frame.getContentOffset());
 
 	return { sizeResults, contrastResults };
 }
 
-bool Fonttik::setResolutionGuideline(const Media& media)
+const SizeGuidelines* Fonttik::findResolutionGuideline(const Media& media) const
 {
 	if (configuration->getAppSettings().detectResolution)
 	{
@@ -261,36 +910,35 @@ bool Fonttik::setResolutionGuideline(const Media& media)
 		// If within 100px of target resolution we accept it as good
 		if (checkResolution(media.getImageSize(), RESOLUTION_2160p))
 		{
-			RESOLUTION_2160p.height;
-			return configuration->setResolutionGuideline("2160");
+			return configuration->findResolutionGuideline("2160");
 		}
 		else if (checkResolution(media.getImageSize(), RESOLUTION_1080p))
 		{
-			return configuration->setResolutionGuideline("1080");
+			return configuration->findResolutionGuideline("1080");
 		}
 		else if (checkResolution(media.getImageSize(), RESOLUTION_720p))
 		{
-			return configuration->setResolutionGuideline("720");
+			return configuration->findResolutionGuideline("720");
 		}
 		else if (checkResolution(media.getImageSize(), RESOLUTION_STEAM_DECK))
 		{
-			return configuration->setResolutionGuideline("1080");
+			return configuration->findResolutionGuideline("1080");
 		}
 		else
 		{
 			LOG_CORE_ERROR("Resolution not supported: {}x{}", media.getImageSize().width, media.getImageSize().height);
-			return false;
+			return nullptr;
 		}
 	}
 	else
 	{
 		LOG_CORE_INFO("Resolution detection is disabled, using specified resolution: {}",
 			configuration->getAppSettings().targetResolution);
-		return configuration->setResolutionGuideline(configuration->getAppSettings().targetResolution);
+		return configuration->findResolutionGuideline(configuration->getAppSettings().targetResolution);
 	}
 }
 
-bool Fonttik::checkResolution(const cv::Size& mediaSize, const cv::Size& resolution)
+bool Fonttik::checkResolution(const cv::Size& mediaSize, const cv::Size& resolution) const
 {
 	return (mediaSize.width + MAX_LEEWAY > resolution.width && mediaSize.width - MAX_LEEWAY <= resolution.width)
 		&& (mediaSize.height + MAX_LEEWAY > resolution.height && mediaSize.height - MAX_LEEWAY <= resolution.height);
@@ -323,6 +971,15 @@ void Fonttik::setTextInContrastResults(const FrameResults& sizeResults, FrameRes
 	}
 }
 
+void Fonttik::offsetResults(FrameResults& results, const cv::Point& offset)
+{
+	for (ResultBox& box : results.results)
+	{
+		box.x += offset.x;
+		box.y += offset.y;
+	}
+}
+
 Fonttik::~Fonttik()
 {
 	if (textBoxDetection != nullptr) 
@@ -349,6 +1006,21 @@ Fonttik::~Fonttik()
 	{
 		delete colorblindFilters;
 	}
+
+	if (textPrefilter != nullptr)
+	{
+		delete textPrefilter;
+	}
+
+	if (boxCache != nullptr)
+	{
+		delete boxCache;
+	}
+
+	if (analysisContext != nullptr)
+	{
+		delete analysisContext;
+	}
 }
 
 } //namescape tik
\ No newline at end of file
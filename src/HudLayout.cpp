@@ -0,0 +1,134 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "HudLayout.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <climits>
+
+namespace tik
+{
+
+HudLayout::HudLayout(const PerformanceParams& params) :
+	learningFrames(params.hudLearningFrames), rescanInterval(params.hudRescanInterval), minHitRatio(params.hudMinHitRatio),
+	regionMargin(params.hudRegionMargin), maxRegions(params.hudMaxRegions)
+{
+}
+
+HudLayout::Plan HudLayout::planFrame(const cv::Size& size)
+{
+	if (size != frameSize)
+	{
+		if (!frameSize.empty())
+		{
+			LOG_CORE_DEBUG("Frame size changed, learning HUD layout again");
+		}
+		frameSize = size;
+		heat = cv::Mat::zeros((size.height + CELL_SIZE - 1) / CELL_SIZE, (size.width + CELL_SIZE - 1) / CELL_SIZE, CV_32F);
+		fullScans = 0;
+		framesSinceFullScan = 0;
+		regionsDirty = true;
+	}
+
+	if (fullScans < learningFrames || framesSinceFullScan >= rescanInterval)
+	{
+		framesSinceFullScan = 0;
+		stats.fullScans++;
+		return {};
+	}
+
+	framesSinceFullScan++;
+	if (regionsDirty)
+	{
+		updateRegions();
+	}
+
+	size_t area = 0;
+	for (const cv::Rect& region : regions)
+	{
+		area += region.area();
+	}
+	stats.regionScans++;
+	coverageSum += double(area) / frameSize.area();
+	stats.regionCoverage = coverageSum / stats.regionScans;
+
+	return { false, regions };
+}
+
+void HudLayout::addDetections(const std::vector<cv::Rect>& boxes)
+{
+	cv::Mat hits = cv::Mat::zeros(heat.size(), CV_8U);
+	for (const cv::Rect& box : boxes)
+	{
+		cv::Rect cells(box.x / CELL_SIZE, box.y / CELL_SIZE, 0, 0);
+		cells.width = (box.br().x + CELL_SIZE - 1) / CELL_SIZE - cells.x;
+		cells.height = (box.br().y + CELL_SIZE - 1) / CELL_SIZE - cells.y;
+		cells &= cv::Rect(0, 0, hits.cols, hits.rows);
+		if (!cells.empty())
+		{
+			hits(cells).setTo(1);
+		}
+	}
+
+	//Overlapping boxes count once per frame
+	cv::add(heat, hits, heat, cv::noArray(), CV_32F);
+	fullScans++;
+	regionsDirty = true;
+}
+
+void HudLayout::updateRegions()
+{
+	regionsDirty = false;
+	regions.clear();
+
+	cv::Mat hot = heat >= std::max(1.0f, minHitRatio * fullScans);
+	if (cv::countNonZero(hot) == 0)
+	{
+		return;
+	}
+
+	const cv::Rect frameRect(0, 0, frameSize.width, frameSize.height);
+	std::vector<std::vector<cv::Point>> contours;
+	cv::findContours(hot, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+	for (const auto& contour : contours)
+	{
+		cv::Rect cells = cv::boundingRect(contour);
+		cv::Rect region(cells.x * CELL_SIZE - regionMargin, cells.y * CELL_SIZE - regionMargin,
+			cells.width * CELL_SIZE + 2 * regionMargin, cells.height * CELL_SIZE + 2 * regionMargin);
+		regions.push_back(region & frameRect);
+	}
+
+	//Merge overlapping regions, then the pairs that grow the least when merged until under the limit
+	while (regions.size() > 1)
+	{
+		size_t bestA = 0, bestB = 0;
+		int bestGrowth = INT_MAX;
+		for (size_t a = 0; a < regions.size(); a++)
+		{
+			for (size_t b = a + 1; b < regions.size(); b++)
+			{
+				int growth = (regions[a] & regions[b]).area() > 0 ? INT_MIN :
+					(regions[a] | regions[b]).area() - regions[a].area() - regions[b].area();
+				if (growth < bestGrowth)
+				{
+					bestGrowth = growth;
+					bestA = a;
+					bestB = b;
+				}
+			}
+		}
+
+		if (bestGrowth != INT_MIN && regions.size() <= size_t(maxRegions))
+		{
+			break;
+		}
+
+		regions[bestA] |= regions[bestB];
+		regions.erase(regions.begin() + bestB);
+	}
+
+	LOG_CORE_DEBUG("HUD layout has {} regions after {} full scans", regions.size(), fullScans);
+}
+
+}
@@ -0,0 +1,64 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <opencv2/core.hpp>
+#include "fonttik/Metrics.hpp"
+#include <vector>
+
+namespace tik
+{
+
+struct PerformanceParams;
+
+/// <summary>
+/// Learns where HUD text sits in a video. Detections of full frame scans are accumulated in a coarse heat map,
+/// once enough frames have been seen detection is restricted to the hot regions, with a periodic full scan to catch new text.
+/// </summary>
+class HudLayout
+{
+public:
+	//What the next frame should be detected on
+	struct Plan
+	{
+		bool fullScan = true;
+		std::vector<cv::Rect> regions; //regions to detect in when not doing a full scan, can be empty
+	};
+
+	HudLayout(const PerformanceParams& params);
+
+	/// <summary>
+	/// Returns how the next frame of the given size should be scanned. A frame size change restarts learning
+	/// </summary>
+	Plan planFrame(const cv::Size& frameSize);
+
+	/// <summary>
+	/// Adds the boxes found by a full scan of the planned frame to the heat map
+	/// </summary>
+	void addDetections(const std::vector<cv::Rect>& boxes);
+
+	HudLayoutStats getStats() const { return stats; }
+
+private:
+	//Thresholds the heat map into at most maxRegions padded regions, in frame coordinates
+	void updateRegions();
+
+	int learningFrames;
+	int rescanInterval;
+	float minHitRatio;
+	int regionMargin;
+	int maxRegions;
+
+	static const int CELL_SIZE = 16; //frame pixels covered by each heat map cell
+
+	cv::Size frameSize;
+	cv::Mat heat; //full scans each cell had a detection in
+	int fullScans = 0;
+	int framesSinceFullScan = 0;
+	bool regionsDirty = true;
+	std::vector<cv::Rect> regions;
+
+	HudLayoutStats stats;
+	double coverageSum = 0;
+};
+
+}
@@ -11,6 +11,13 @@ namespace tik
 {
 class Configuration;
 
+enum CheckType
+{
+	SIZE_CHECK = 0,
+	CONTRAST_CHECK,
+	CHECK_TYPE_COUNT
+};
+
 class IChecker 
 {
 public:
@@ -21,9 +28,9 @@ public:
 
 protected:
 
-	IChecker(Configuration* config) : configuration(config){};
+	IChecker(const Configuration* config) : configuration(config){};
 
-	Configuration* configuration;
+	const Configuration* configuration;
 };
 
 }
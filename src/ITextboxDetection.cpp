@@ -18,6 +18,52 @@ namespace tik {
 		return asin(h / hip);
 	}
 
+	void ITextboxDetection::warmUp(const cv::Size& frameSize)
+	{
+		cv::Mat blank = cv::Mat::zeros(frameSize, CV_8UC3);
+		detectBoxes(blank);
+	}
+
+	std::vector<TextBox> ITextboxDetection::detectBoxesInRegions(const cv::Mat& img, const std::vector<cv::Rect>& regions, bool fixedRegions)
+	{
+		variableInputSize = !fixedRegions;
+		std::vector<TextBox> boxes;
+		for (const cv::Rect& region : regions)
+		{
+			std::vector<TextBox> regionBoxes = detectBoxes(img(region));
+			offsetBoxes(regionBoxes, region, img);
+			boxes.insert(boxes.end(), regionBoxes.begin(), regionBoxes.end());
+		}
+		variableInputSize = false;
+
+		return boxes;
+	}
+
+	LinesAndWords ITextboxDetection::detectLinesAndWordsInRegions(const cv::Mat& img, const std::vector<cv::Rect>& regions, bool fixedRegions)
+	{
+		variableInputSize = !fixedRegions;
+		LinesAndWords linesAndWords;
+		for (const cv::Rect& region : regions)
+		{
+			LinesAndWords regionLinesAndWords = detectLinesAndWords(img(region));
+			offsetBoxes(regionLinesAndWords.lines, region, img);
+			offsetBoxes(regionLinesAndWords.words, region, img);
+			linesAndWords.lines.insert(linesAndWords.lines.end(), regionLinesAndWords.lines.begin(), regionLinesAndWords.lines.end());
+			linesAndWords.words.insert(linesAndWords.words.end(), regionLinesAndWords.words.begin(), regionLinesAndWords.words.end());
+		}
+		variableInputSize = false;
+
+		return linesAndWords;
+	}
+
+	void ITextboxDetection::offsetBoxes(std::vector<TextBox>& boxes, const cv::Rect& region, const cv::Mat& img)
+	{
+		for (TextBox& box : boxes)
+		{
+			box = TextBox(box.getTextBoxRect() + region.tl(), img);
+		}
+	}
+
 	void ITextboxDetection::mergeTextBoxes(std::vector<TextBox>& boxes, cv::Mat img) 
 	{
 		std::pair<float, float> mergeThreshold = detectionParams->mergeThreshold;
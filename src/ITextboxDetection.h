@@ -4,6 +4,7 @@
 #include <vector>
 #include <opencv2/core.hpp>
 #include "fonttik/TextBox.hpp"
+#include "fonttik/Metrics.hpp"
 
 namespace tik {
 	
@@ -24,6 +25,22 @@ public:
 	virtual std::vector<TextBox> detectBoxes(const cv::Mat& img) = 0;
 	virtual LinesAndWords detectLinesAndWords(const cv::Mat& img) = 0;
 
+	//Detects only inside the given regions of img, boxes are returned in img coordinates. Thresholds still follow the size of the whole
+	//frame. fixedRegions tells that the same regions come back on the next frames, as HUD regions do until the next layout scan, so
+	//detectors keep their input shapes cached instead of treating them as one-off sizes
+	std::vector<TextBox> detectBoxesInRegions(const cv::Mat& img, const std::vector<cv::Rect>& regions, bool fixedRegions = false);
+	LinesAndWords detectLinesAndWordsInRegions(const cv::Mat& img, const std::vector<cv::Rect>& regions, bool fixedRegions = false);
+
+	//Runs a detection over a blank frame of the expected size so the backend allocates its buffers before the first real frame
+	virtual void warmUp(const cv::Size& frameSize);
+
+	//Scales the network input of the next detections, real-time mode uses it to detect at a coarser scale
+	void setInputScale(double scale) { inputScale = scale; }
+	double getInputScale() const { return inputScale; }
+
+	//Hits and misses of the input buffers kept allocated per input size
+	virtual CacheStats getInputCacheStats() const { return {}; }
+
 	//Merges textboxes given a certain threshold for horizontal and vertical overlap
 	void mergeTextBoxes(std::vector<TextBox>& textBoxe, cv::Mat img);
 
@@ -34,9 +51,17 @@ protected:
 	//Initialize textbox detection with configuration parameters, must be called before any detection calls
 	ITextboxDetection(const TextDetectionParams& params) : detectionParams(&params) {};
 
+	//Moves boxes found in region back to img coordinates
+	static void offsetBoxes(std::vector<TextBox>& boxes, const cv::Rect& region, const cv::Mat& img);
+
 	//Caching of appSettings and textDetectionParams pointers
 	const TextDetectionParams* detectionParams;
 	std::vector<double> sRGB_LUT;
+
+	//Set while detecting in regions whose sizes change between calls, detectors shouldn't cache an input shape for each of them
+	bool variableInputSize = false;
+
+	double inputScale = 1.0;
 };
 
 }
\ No newline at end of file
@@ -18,6 +18,21 @@ public:
 
 	virtual std::string recognizeBox(TextBox& box) = 0;
 
+	//Recognizes several boxes of the same frame in one call, backends that can't batch them recognize them one by one
+	virtual std::vector<std::string> recognizeBoxes(const std::vector<TextBox*>& boxes)
+	{
+		std::vector<std::string> texts;
+		texts.reserve(boxes.size());
+		for (TextBox* box : boxes)
+		{
+			texts.push_back(recognizeBox(*box));
+		}
+		return texts;
+	}
+
+	//Runs a recognition over a blank input so the backend allocates its buffers before the first real box
+	virtual void warmUp() {};
+
 protected:
 	ITextBoxRecognition() {};
 };
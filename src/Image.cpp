@@ -7,7 +7,7 @@
 namespace tik
 {
 
-Image::Image(std::string mediaSource, cv::Mat img, ColorblindFilters* colorblindFilters) : Media(mediaSource), frame(img, mask, 0), processed(false),
+Image::Image(std::string mediaSource, cv::Mat img, ColorblindFilters* colorblindFilters) : Media(mediaSource), frame(img, mask, 0), processed(false), hasColorblindFrames(colorblindFilters != nullptr),
 protanFrame(img, mask, 0), deutanFrame(img, mask, 0), tritanFrame(img, mask, 0), grayscaleFrame(img, mask, 0)
 {
 	imageSize = img.size();
@@ -31,11 +31,23 @@ bool Image::loadFrame()
 Frame Image::getFrame()
 {
 	processed = true;
+	updateContentRect(frame.getFrameMat());
+	frame.setContentRect(contentRect);
 	return frame;
 }
 
 std::vector<Frame>Image::getColorblindFrames()
 {
+	if (!hasColorblindFrames)
+	{
+		return {};
+	}
+
+	//Colorblind frames share the borders of the original one
+	for (Frame* colorblindFrame : { &protanFrame, &deutanFrame, &tritanFrame, &grayscaleFrame })
+	{
+		colorblindFrame->setContentRect(contentRect);
+	}
 	return { protanFrame, deutanFrame, tritanFrame, grayscaleFrame };
 }
 
@@ -91,10 +103,13 @@ void Image::saveResultsOutlinesAsync(const SaveResultProperties& sizeResultPrope
 			queue.pop();
 			sizeProps.results.push_back(current.size);
 			contrastProps.results.push_back(current.contrast);
-			saveColorblindImages();
+			if (hasColorblindFrames)
+			{
+				saveColorblindImages();
+			}
 			saveResultsOutlines(sizeProps, contrastProps);
-			storeResultsInJSON(current.size.results, 0, outSizeJson);
-			storeResultsInJSON(current.contrast.results, 0, outContrastJson, true);
+			storeResultsInJSON(current.size, 0, outSizeJson);
+			storeResultsInJSON(current.contrast, 0, outContrastJson, true);
 		}
 	}
 	outSizeJson.seekp((long)outSizeJson.tellp() - 2l);
@@ -103,15 +118,19 @@ void Image::saveResultsOutlinesAsync(const SaveResultProperties& sizeResultPrope
 	outContrastJson << "]\n";
 }
 
-void Image::storeResultsInJSON(const std::vector<ResultBox>& res, int id, std::ofstream& out, bool contrast) 
+void Image::storeResultsInJSON(const FrameResults& results, int id, std::ofstream& out, bool contrast) 
 {
 		using json = nlohmann::json;
 		json jFrame = json();
 		jFrame["id"] = id;
+		if (results.degradedStages != DEGRADED_NONE)
+		{
+			jFrame["degraded"] = tik::DegradedStagesAsStrings(results.degradedStages);
+		}
 
 		jFrame["results"] = json::array();
 
-		for (auto res : res)
+		for (auto res : results.results)
 		{
 			json jResult = json();
 			jResult["type"] = tik::ResultTypeAsString(res.type);
@@ -121,8 +140,12 @@ void Image::storeResultsInJSON(const std::vector<ResultBox>& res, int id, std::o
 			jResult["height"] = res.height;
 			jResult["value"] = res.value;
 			jResult["text"] = res.text;
+			if (res.trackId >= 0)
+			{
+				jResult["trackId"] = res.trackId;
+			}
 
-			if (contrast)
+			if (contrast && !res.colorblindValues.empty())
 			{
 				jResult["protanValue"] = res.colorblindValues[0];
 				jResult["protanType"] = tik::ResultTypeAsString(res.colorblindTypes[0]);
@@ -143,7 +166,7 @@ void Image::storeResultsInJSON(const std::vector<ResultBox>& res, int id, std::o
 fs::path Image::saveResultsOutlines(const std::vector<FrameResults>& results, fs::path path, 
 	const std::vector<cv::Scalar>& colors, bool saveNumbers) 
 {
-	if (path.stem() == "contrastChecks")
+	if (path.stem() == "contrastChecks" && hasColorblindFrames)
 	{
 		std::vector<fs::path> colorblindPaths = {
 			path.parent_path() / "protanChecks.png",
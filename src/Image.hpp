@@ -25,6 +25,7 @@ public:
 	/// </summary>
 	virtual Frame getFrame() override;
 	virtual std::vector<Frame> getColorblindFrames() override;
+	virtual bool producesColorblindFrames() const override { return hasColorblindFrames; }
 
 	std::pair<fs::path, fs::path>saveResultsOutlines(const SaveResultProperties& sizeResultProperties, 
 		const SaveResultProperties& contrastResultProperties) override;
@@ -40,13 +41,14 @@ private:
 	fs::path saveResultsOutlines(const std::vector<FrameResults>& results, fs::path path, 
 		const std::vector<cv::Scalar>& colors, bool saveNumbers);
 
-	void storeResultsInJSON(const std::vector<ResultBox>& res, int id, std::ofstream& out, bool contrast=false);
+	void storeResultsInJSON(const FrameResults& results, int id, std::ofstream& out, bool contrast=false);
 
 	void saveColorblindImages();
 
 	Frame frame;
 	Frame protanFrame, deutanFrame, tritanFrame, grayscaleFrame;
 	bool processed;
+	bool hasColorblindFrames; //Only true when colorblind filters were supplied
 	
 	
 };
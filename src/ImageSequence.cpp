@@ -0,0 +1,529 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/ImageSequence.hpp"
+#include "fonttik/Frame.hpp"
+#include "fonttik/Log.h"
+#include "Video.hpp"
+#include "ThreadBudget.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace tik
+{
+
+/// <summary>
+/// Decodes the frames the analysis will ask for next on a few threads. The frames wanted next are a window of prefetch frames starting
+/// at the last requested one, step frames apart. Decoded frames outside the window are dropped, so at most prefetch frames are kept.
+/// </summary>
+class ImageSequence::Decoder
+{
+public:
+	static constexpr int DECODE_THREADS = 3;
+
+	Decoder(const std::vector<fs::path>& frames, int prefetch) : frames(frames), prefetch(std::max(prefetch, 1)),
+		lease(ThreadBudget::getInstance().acquire(1 + std::min(DECODE_THREADS, prefetch)))
+	{
+		for (int i = 1; i < lease.size(); i++)
+		{
+			workers.emplace_back(&Decoder::decodeFrames, this);
+		}
+	}
+
+	~Decoder()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wakeDecoders.notify_all();
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+	}
+
+	/// <summary>
+	/// Returns the image of a frame, waiting for it to be decoded, and queues the frames after it for decoding
+	/// </summary>
+	/// <returns>An empty Mat if the image can't be read</returns>
+	cv::Mat get(int index, int step)
+	{
+		//Without decoding threads frames are decoded as they are asked for
+		if (workers.empty())
+		{
+			return cv::imread(frames[index].string(), cv::IMREAD_COLOR);
+		}
+
+		std::unique_lock<std::mutex> lock(mutex);
+		windowStart = index;
+		windowStep = std::max(step, 1);
+
+		for (auto it = decoded.begin(); it != decoded.end();)
+		{
+			it = isWanted(it->first) ? std::next(it) : decoded.erase(it);
+		}
+
+		pending.clear();
+		for (int i = 0; i < prefetch; i++)
+		{
+			const int next = index + i * windowStep;
+			if (next >= static_cast<int>(frames.size()))
+			{
+				break;
+			}
+			if (decoded.count(next) == 0 && decoding.count(next) == 0)
+			{
+				pending.push_back(next);
+			}
+		}
+		wakeDecoders.notify_all();
+
+		frameDecoded.wait(lock, [&]() { return decoded.count(index) != 0; });
+		cv::Mat image = decoded[index];
+		decoded.erase(index);
+		return image;
+	}
+
+private:
+	bool isWanted(int index) const
+	{
+		return index >= windowStart && (index - windowStart) % windowStep == 0 && (index - windowStart) / windowStep < prefetch;
+	}
+
+	void decodeFrames()
+	{
+		ThreadBudget::getInstance().pinCurrentThread();
+
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true)
+		{
+			wakeDecoders.wait(lock, [&]() { return stopping || !pending.empty(); });
+			if (stopping)
+			{
+				return;
+			}
+
+			const int index = pending.front();
+			pending.pop_front();
+			decoding.insert(index);
+
+			lock.unlock();
+			cv::Mat image = cv::imread(frames[index].string(), cv::IMREAD_COLOR);
+			lock.lock();
+
+			decoding.erase(index);
+			if (isWanted(index))
+			{
+				decoded[index] = image;
+				frameDecoded.notify_all();
+			}
+		}
+	}
+
+	const std::vector<fs::path>& frames;
+	const int prefetch;
+	ThreadBudget::Lease lease;
+	std::vector<std::thread> workers;
+
+	std::mutex mutex;
+	std::condition_variable wakeDecoders, frameDecoded;
+	std::deque<int> pending; //frames waiting for a decoding thread, in the order they'll be asked for
+	std::set<int> decoding;
+	std::map<int, cv::Mat> decoded;
+	int windowStart = 0, windowStep = 1;
+	bool stopping = false;
+};
+
+//Position and length of the integer field in a pattern's file name, npos if there isn't exactly one
+static std::pair<size_t, size_t> findPatternField(const std::string& name)
+{
+	const size_t percent = name.find('%');
+	if (percent == std::string::npos)
+	{
+		return { std::string::npos, 0 };
+	}
+
+	size_t end = percent + 1;
+	while (end < name.size() && std::isdigit(static_cast<unsigned char>(name[end])))
+	{
+		end++;
+	}
+
+	if (end >= name.size() || name[end] != 'd' || name.find('%', end) != std::string::npos)
+	{
+		return { std::string::npos, 0 };
+	}
+	return { percent, end + 1 - percent };
+}
+
+//Compares file names with the numbers in them compared by value
+static bool naturalLess(const std::string& a, const std::string& b)
+{
+	auto isDigit = [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; };
+
+	size_t i = 0, j = 0;
+	while (i < a.size() && j < b.size())
+	{
+		if (isDigit(a[i]) && isDigit(b[j]))
+		{
+			size_t endA = i, endB = j;
+			while (endA < a.size() && isDigit(a[endA])) endA++;
+			while (endB < b.size() && isDigit(b[endB])) endB++;
+
+			//Leading zeros don't change the value, longer numbers are larger
+			while (i + 1 < endA && a[i] == '0') i++;
+			while (j + 1 < endB && b[j] == '0') j++;
+			if (endA - i != endB - j)
+			{
+				return endA - i < endB - j;
+			}
+
+			const int comparison = a.compare(i, endA - i, b, j, endB - j);
+			if (comparison != 0)
+			{
+				return comparison < 0;
+			}
+			i = endA;
+			j = endB;
+		}
+		else
+		{
+			if (a[i] != b[j])
+			{
+				return a[i] < b[j];
+			}
+			i++;
+			j++;
+		}
+	}
+	return a.size() - i < b.size() - j;
+}
+
+//Folder the outputs of a sequence are stored next to
+static fs::path getSequenceFolder(const fs::path& folder)
+{
+	fs::path normal = fs::absolute(folder.empty() ? fs::path(".") : folder).lexically_normal();
+	return normal.has_filename() ? normal : normal.parent_path();
+}
+
+bool ImageSequence::isPattern(const std::string& path)
+{
+	return findPatternField(fs::path(path).filename().string()).first != std::string::npos;
+}
+
+std::vector<fs::path> ImageSequence::findPatternFrames(const std::string& pattern)
+{
+	const fs::path folder = getSequenceFolder(fs::path(pattern).parent_path());
+	const std::string name = fs::path(pattern).filename().string();
+	const std::pair<size_t, size_t> field = findPatternField(name);
+	if (field.first == std::string::npos || !fs::is_directory(folder))
+	{
+		return {};
+	}
+
+	const std::string prefix = name.substr(0, field.first);
+	const std::string suffix = name.substr(field.first + field.second);
+
+	std::vector<std::pair<int, fs::path>> numbered;
+	for (const fs::directory_entry& entry : fs::directory_iterator(folder))
+	{
+		const std::string file = entry.path().filename().string();
+		if (!entry.is_regular_file() || file.size() <= prefix.size() + suffix.size() || file.compare(0, prefix.size(), prefix) != 0
+			|| file.compare(file.size() - suffix.size(), suffix.size(), suffix) != 0)
+		{
+			continue;
+		}
+
+		const std::string digits = file.substr(prefix.size(), file.size() - prefix.size() - suffix.size());
+		if (digits.size() > 9 || !std::all_of(digits.begin(), digits.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }))
+		{
+			continue;
+		}
+
+		//Printing the number back has to give the same name, so the padding matches too
+		const int number = std::stoi(digits);
+		std::vector<char> printed(name.size() + 16);
+		std::snprintf(printed.data(), printed.size(), name.c_str(), number);
+		if (file == printed.data())
+		{
+			numbered.emplace_back(number, entry.path());
+		}
+	}
+
+	std::sort(numbered.begin(), numbered.end());
+
+	std::vector<fs::path> frames;
+	for (const std::pair<int, fs::path>& frame : numbered)
+	{
+		frames.push_back(frame.second);
+	}
+	return frames;
+}
+
+std::vector<fs::path> ImageSequence::findDirectoryFrames(const fs::path& directory, SequenceOrder order)
+{
+	std::vector<fs::path> frames;
+	if (!fs::is_directory(directory))
+	{
+		return frames;
+	}
+
+	for (const fs::directory_entry& entry : fs::directory_iterator(directory))
+	{
+		if (entry.is_regular_file() && cv::haveImageReader(entry.path().string()))
+		{
+			frames.push_back(entry.path());
+		}
+	}
+
+	auto byName = [](const fs::path& a, const fs::path& b) { return naturalLess(a.filename().string(), b.filename().string()); };
+	switch (order)
+	{
+	case SequenceOrder::Name:
+		std::sort(frames.begin(), frames.end(), [](const fs::path& a, const fs::path& b) { return a.filename() < b.filename(); });
+		break;
+	case SequenceOrder::ModifiedTime:
+	{
+		std::map<fs::path, fs::file_time_type> times;
+		for (const fs::path& frame : frames)
+		{
+			times[frame] = fs::last_write_time(frame);
+		}
+		std::sort(frames.begin(), frames.end(), [&](const fs::path& a, const fs::path& b)
+			{
+				return (times[a] != times[b]) ? times[a] < times[b] : byName(a, b);
+			});
+		break;
+	}
+	default:
+		std::sort(frames.begin(), frames.end(), byName);
+		break;
+	}
+	return frames;
+}
+
+ImageSequence* ImageSequence::fromPattern(const std::string& pattern, double fps, int prefetch)
+{
+	std::vector<fs::path> frames = findPatternFrames(pattern);
+	if (frames.empty())
+	{
+		LOG_CORE_ERROR("No file matches {}", pattern);
+		return nullptr;
+	}
+
+	ImageSequence* sequence = new ImageSequence(getSequenceFolder(fs::path(pattern).parent_path()).string(), std::move(frames), fps, prefetch);
+	if (sequence->getImageSize().empty())
+	{
+		delete sequence;
+		return nullptr;
+	}
+	return sequence;
+}
+
+ImageSequence* ImageSequence::fromDirectory(const fs::path& directory, SequenceOrder order, double fps, int prefetch)
+{
+	std::vector<fs::path> frames = findDirectoryFrames(directory, order);
+	if (frames.empty())
+	{
+		LOG_CORE_ERROR("{} has no images", directory.string());
+		return nullptr;
+	}
+
+	ImageSequence* sequence = new ImageSequence(getSequenceFolder(directory).string(), std::move(frames), fps, prefetch);
+	if (sequence->getImageSize().empty())
+	{
+		delete sequence;
+		return nullptr;
+	}
+	return sequence;
+}
+
+ImageSequence::ImageSequence(std::string name, std::vector<fs::path> sequenceFrames, double fps, int prefetch) : Media(name),
+	frames(std::move(sequenceFrames)), fps((fps > 0) ? fps : DEFAULT_FPS), prefetch(prefetch)
+{
+	frameIndex = -1;
+
+	//Every frame must have the size of the first one, as video frames do
+	if (!frames.empty())
+	{
+		imageSize = cv::imread(frames.front().string(), cv::IMREAD_COLOR).size();
+	}
+	if (imageSize.empty())
+	{
+		LOG_CORE_ERROR("Image sequence {} could not be opened", mediaSource);
+	}
+	else
+	{
+		LOG_CORE_INFO("Image sequence {} has {} frames of {}x{}", mediaSource, frames.size(), imageSize.width, imageSize.height);
+	}
+}
+
+ImageSequence::~ImageSequence() = default;
+
+bool ImageSequence::loadFrameFrom(int index, int step)
+{
+	for (; index < getFrameCount(); index++, step = 1)
+	{
+		cv::Mat image = decoder->get(index, step);
+		if (!image.empty() && image.size() == imageSize)
+		{
+			currentFrame = image;
+			frameIndex = index;
+			return true;
+		}
+		LOG_CORE_WARNING("{} can't be read as a {}x{} frame, skipping it", frames[index].string(), imageSize.width, imageSize.height);
+	}
+	return false;
+}
+
+bool ImageSequence::loadFrame()
+{
+	if (decoder == nullptr)
+	{
+		decoder = std::make_unique<Decoder>(frames, prefetch);
+	}
+
+	const bool first = currentFrame.empty();
+	const int step = std::max(framesToSkip - 1, 1);
+	previousFrame = currentFrame;
+
+	//Frames are read directly, skipped ones and the ones real-time mode drops are never decoded. The same frames as in a video are picked
+	if (!loadFrameFrom(first ? 0 : Video::nextCandidateFrame(frameIndex, framesToSkip, playbackFrame), step))
+	{
+		return false;
+	}
+
+	//Keep loading frames until the sequence is over or one is sufficiently different from the previously analysed one
+	while (!first && Video::compareFramesSimilarity(previousFrame, currentFrame))
+	{
+		if (!loadFrameFrom(frameIndex + 1, 1))
+		{
+			return false;
+		}
+	}
+
+	LOG_CORE_INFO("Processing sequence frame {0} - {1:.3}%", frameIndex, 100.0 * (frameIndex + 1) / getFrameCount());
+	msTimeStamp = static_cast<int>(1000.0 * frameIndex / fps);
+	return true;
+}
+
+Frame ImageSequence::getFrame()
+{
+	updateContentRect(currentFrame);
+
+	Frame frame(currentFrame, mask, frameIndex, msTimeStamp);
+	frame.setContentRect(contentRect);
+	return frame;
+}
+
+std::pair<fs::path, fs::path> ImageSequence::saveResultsOutlines(const SaveResultProperties& sizeResultProperties,
+	const SaveResultProperties& contrastResultProperties)
+{
+	if (sizeResultProperties.results.empty() || contrastResultProperties.results.empty())
+	{
+		return {};
+	}
+
+	LOG_CORE_DEBUG("Storing results at {}", getOutputPath().string());
+
+	//Cap the output at 1080p like videos
+	cv::Size size = imageSize;
+	if (size.width > 1920 || size.height > 1080)
+	{
+		size.width = 1920;
+		size.height = 1080;
+	}
+
+	cv::VideoWriter outVideoSize = Video::CreateOutputVideoWritter(sizeResultProperties.path, size, fps);
+	cv::VideoWriter outVideoContrast = Video::CreateOutputVideoWritter(contrastResultProperties.path, size, fps);
+
+	if (decoder == nullptr)
+	{
+		decoder = std::make_unique<Decoder>(frames, prefetch);
+	}
+
+	//Every frame is written with the results of the last frame analysed before it
+	size_t resultIndex = 0;
+	for (int i = 0; i < getFrameCount(); i++)
+	{
+		while (resultIndex + 1 < sizeResultProperties.results.size() && i >= sizeResultProperties.results[resultIndex + 1].frame)
+		{
+			resultIndex++;
+		}
+
+		cv::Mat frameMat = decoder->get(i, 1);
+		if (frameMat.empty() || frameMat.size() != imageSize)
+		{
+			continue;
+		}
+		if (!mask.empty())
+		{
+			frameMat = frameMat & mask;
+		}
+
+		std::thread t1(Video::storeResultsInFrame, frameMat.clone(), std::ref(sizeResultProperties.results[resultIndex].results), sizeResultProperties, false, outVideoSize, size);
+		std::thread t2(Video::storeResultsInFrame, frameMat, std::ref(contrastResultProperties.results[resultIndex].results), contrastResultProperties, true, outVideoContrast, size);
+		t1.join();
+		t2.join();
+	}
+
+	return { sizeResultProperties.path, contrastResultProperties.path };
+}
+
+void ImageSequence::saveResultsOutlinesAsync(const SaveResultProperties& sizeResultProperties,
+	const SaveResultProperties& contrastResultProperties, rigtorp::SPSCQueue<FrameResult>& queue, std::atomic<bool>& done)
+{
+	SaveResultProperties sizeProps = sizeResultProperties;
+	SaveResultProperties contrastProps = contrastResultProperties;
+	fs::path outputPath = getOutputPath();
+	std::ofstream outSizeJson(outputPath / "sizeChecks.json");
+	std::ofstream outContrastJson(outputPath / "contrastChecks.json");
+
+	//Results are stored as they arrive, the outline videos need every frame's results and are written at the end
+	outSizeJson << "[\n";
+	outContrastJson << "[\n";
+	while (!(queue.empty() && done))
+	{
+		if (queue.front())
+		{
+			FrameResult current = *queue.front();
+			queue.pop();
+			sizeProps.results.push_back(current.size);
+			contrastProps.results.push_back(current.contrast);
+			Video::storeResultsInJSON(current.size, current.size.frame, current.timeStamp, outSizeJson);
+			Video::storeResultsInJSON(current.contrast, current.contrast.frame, current.timeStamp, outContrastJson);
+		}
+	}
+
+	if (!sizeProps.results.empty())
+	{
+		outSizeJson.seekp((long)outSizeJson.tellp() - 2l);
+		outContrastJson.seekp((long)outContrastJson.tellp() - 2l);
+	}
+	outSizeJson << "]\n";
+	outContrastJson << "]\n";
+
+	saveResultsOutlines(sizeProps, contrastProps);
+}
+
+void ImageSequence::setAnalysisWaitSeconds(int aws)
+{
+	framesToSkip = static_cast<int>(fps * aws);
+	LOG_CORE_INFO("Skipping every {} seconds, every {} frames", aws, framesToSkip);
+}
+
+void ImageSequence::setPlaybackPosition(int msSinceStart)
+{
+	playbackFrame = static_cast<int>(int64_t(msSinceStart) * fps / 1000);
+}
+
+}
@@ -0,0 +1,173 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "IncrementalAnalysis.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+#include <opencv2/imgproc.hpp>
+
+namespace tik
+{
+
+IncrementalAnalysis::IncrementalAnalysis(const PerformanceParams& params) :
+	tileSize(params.incrementalTileSize), margin(params.incrementalMargin), pixelThreshold(params.incrementalPixelThreshold),
+	maxChangedArea(params.incrementalMaxChangedArea)
+{
+}
+
+void IncrementalAnalysis::toGray(const cv::Mat& frame, cv::Mat& gray)
+{
+	if (frame.channels() == 1)
+	{
+		frame.copyTo(gray);
+	}
+	else
+	{
+		cv::cvtColor(frame, gray, (frame.channels() == 4) ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+	}
+}
+
+IncrementalAnalysis::Update IncrementalAnalysis::findChanges(const cv::Mat& frame)
+{
+	toGray(frame, currentGray);
+	hasCurrentGray = true;
+
+	if (previousGray.empty() || previousGray.size() != currentGray.size())
+	{
+		stats.fullFrames++;
+		return {};
+	}
+
+	//Pixels that changed more than compression noise would
+	cv::absdiff(currentGray, previousGray, difference);
+	cv::threshold(difference, difference, pixelThreshold, 255, cv::THRESH_BINARY);
+
+	const int cols = (difference.cols + tileSize - 1) / tileSize;
+	const int rows = (difference.rows + tileSize - 1) / tileSize;
+	cv::Mat changedTiles = cv::Mat::zeros(rows, cols, CV_8U);
+	for (int row = 0; row < rows; row++)
+	{
+		for (int col = 0; col < cols; col++)
+		{
+			cv::Rect tile = cv::Rect(col * tileSize, row * tileSize, tileSize, tileSize) & cv::Rect(0, 0, difference.cols, difference.rows);
+			if (cv::countNonZero(difference(tile)) > TILE_CHANGE_RATIO * tile.area())
+			{
+				changedTiles.at<uchar>(row, col) = 255;
+			}
+		}
+	}
+
+	//Changed tiles are grouped and expanded by the margin so text crossing a tile border is detected whole
+	const cv::Rect frameRect(0, 0, frame.cols, frame.rows);
+	std::vector<std::vector<cv::Point>> contours;
+	cv::findContours(changedTiles, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+
+	Update update{ false, {} };
+	for (const auto& contour : contours)
+	{
+		cv::Rect tiles = cv::boundingRect(contour);
+		update.regions.push_back(cv::Rect(tiles.x * tileSize - margin, tiles.y * tileSize - margin,
+			tiles.width * tileSize + 2 * margin, tiles.height * tileSize + 2 * margin) & frameRect);
+	}
+
+	//Overlapping regions would detect the same text twice
+	for (bool merged = true; merged;)
+	{
+		merged = false;
+		for (size_t i = 0; i < update.regions.size() && !merged; i++)
+		{
+			for (size_t j = i + 1; j < update.regions.size(); j++)
+			{
+				if ((update.regions[i] & update.regions[j]).area() > 0)
+				{
+					update.regions[i] |= update.regions[j];
+					update.regions.erase(update.regions.begin() + j);
+					merged = true;
+					break;
+				}
+			}
+		}
+	}
+
+	size_t changedArea = 0;
+	for (const cv::Rect& region : update.regions)
+	{
+		changedArea += region.area();
+	}
+
+	if (changedArea > maxChangedArea * frameRect.area())
+	{
+		stats.fullFrames++;
+		return {};
+	}
+
+	stats.incrementalFrames++;
+	changedAreaSum += double(changedArea) / frameRect.area();
+	stats.changedArea = changedAreaSum / stats.incrementalFrames;
+
+	LOG_CORE_TRACE("{} changed regions covering {:.1f}% of the frame", update.regions.size(), 100.0 * changedArea / frameRect.area());
+
+	return update;
+}
+
+void IncrementalAnalysis::carryOver(const std::vector<cv::Rect>& regions, FrameResults& sizeResults, FrameResults& contrastResults)
+{
+	//Size checks don't merge their result types into the frame type
+	const size_t previousCount = sizeResults.results.size() + contrastResults.results.size();
+	carryOver(previousSize, regions, sizeResults, false);
+	carryOver(previousContrast, regions, contrastResults, true);
+	stats.carriedResults += sizeResults.results.size() + contrastResults.results.size() - previousCount;
+}
+
+void IncrementalAnalysis::carryOver(const FrameResults& previous, const std::vector<cv::Rect>& regions, FrameResults& results, bool mergeTypes)
+{
+	for (const ResultBox& box : previous.results)
+	{
+		const cv::Rect rect(box.x, box.y, box.width, box.height);
+		bool changed = false;
+		for (const cv::Rect& region : regions)
+		{
+			changed = changed || (rect & region).area() > 0;
+		}
+		if (changed)
+		{
+			continue;
+		}
+
+		results.addResult(box, mergeTypes);
+	}
+}
+
+void IncrementalAnalysis::store(const cv::Mat& frame, FrameResults& sizeResults, FrameResults& contrastResults)
+{
+	for (FrameResults* results : { &sizeResults, &contrastResults })
+	{
+		for (ResultBox& box : results->results)
+		{
+			if (box.measuredFrame < 0)
+			{
+				box.measuredFrame = results->frame;
+			}
+		}
+	}
+
+	if (!hasCurrentGray)
+	{
+		//findChanges wasn't called for this frame
+		toGray(frame, currentGray);
+	}
+	std::swap(previousGray, currentGray);
+	hasCurrentGray = false;
+
+	previousSize = sizeResults;
+	previousContrast = contrastResults;
+}
+
+void IncrementalAnalysis::reset()
+{
+	previousGray.release();
+	hasCurrentGray = false;
+	previousSize = FrameResults(-1);
+	previousContrast = FrameResults(-1);
+}
+
+}
@@ -0,0 +1,72 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <opencv2/core.hpp>
+#include "fonttik/Results.h"
+#include "fonttik/Metrics.hpp"
+#include <vector>
+
+namespace tik
+{
+
+struct PerformanceParams;
+
+/// <summary>
+/// Finds what changed between consecutive analysed frames on a tile grid, so only the changed regions
+/// need detection and checks while the results of the rest of the frame are carried over.
+/// </summary>
+class IncrementalAnalysis
+{
+public:
+	struct Update
+	{
+		bool full = true; //the whole frame has to be analysed
+		std::vector<cv::Rect> regions; //changed regions expanded by the margin, when not full
+	};
+
+	IncrementalAnalysis(const PerformanceParams& params);
+
+	/// <summary>
+	/// Compares frame with the last stored one
+	/// </summary>
+	Update findChanges(const cv::Mat& frame);
+
+	/// <summary>
+	/// Adds the results of the previous frame lying outside of the changed regions to the given results
+	/// </summary>
+	void carryOver(const std::vector<cv::Rect>& regions, FrameResults& sizeResults, FrameResults& contrastResults);
+
+	/// <summary>
+	/// Keeps frame and its results as the reference for the next frame. Boxes measured on this frame are marked with its index
+	/// </summary>
+	void store(const cv::Mat& frame, FrameResults& sizeResults, FrameResults& contrastResults);
+
+	/// <summary>
+	/// Drops the reference frame, the next frame will be analysed whole
+	/// </summary>
+	void reset();
+
+	IncrementalStats getStats() const { return stats; }
+
+private:
+	static void toGray(const cv::Mat& frame, cv::Mat& gray);
+
+	static void carryOver(const FrameResults& previous, const std::vector<cv::Rect>& regions, FrameResults& results, bool mergeTypes);
+
+	int tileSize;
+	int margin;
+	int pixelThreshold; //gray level difference for a pixel to count as changed
+	float maxChangedArea; //share of the frame above which analysing it whole is cheaper
+
+	static constexpr double TILE_CHANGE_RATIO = 0.005; //share of changed pixels for a tile to count as changed
+
+	cv::Mat previousGray, currentGray, difference; //reused between frames
+	bool hasCurrentGray = false; //currentGray holds the frame being analysed
+	FrameResults previousSize{ -1 };
+	FrameResults previousContrast{ -1 };
+
+	IncrementalStats stats;
+	double changedAreaSum = 0;
+};
+
+}
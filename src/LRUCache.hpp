@@ -0,0 +1,111 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/Metrics.hpp"
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace tik
+{
+
+/// <summary>
+/// Fixed capacity cache that evicts the least recently used entry. Not thread-safe.
+/// Entries weigh 1 unless given a weight, e.g. their size in bytes, capacity is the maximum total weight.
+/// </summary>
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRUCache
+{
+public:
+	LRUCache(size_t capacity = 1) : capacity(capacity) {}
+
+	/// <summary>
+	/// Returns the cached value and marks it as the most recently used, nullptr if not cached.
+	/// Pointers stay valid until the entry is evicted.
+	/// </summary>
+	Value* get(const Key& key)
+	{
+		auto it = index.find(key);
+		if (it == index.end())
+		{
+			stats.misses++;
+			return nullptr;
+		}
+
+		stats.hits++;
+		entries.splice(entries.begin(), entries, it->second);
+		return &it->second->value;
+	}
+
+	/// <summary>
+	/// Inserts or replaces a value, evicting the least recently used entries over capacity
+	/// </summary>
+	Value& put(const Key& key, Value value, size_t weight = 1)
+	{
+		auto it = index.find(key);
+		if (it != index.end())
+		{
+			totalWeight = totalWeight - it->second->weight + weight;
+			it->second->value = std::move(value);
+			it->second->weight = weight;
+			entries.splice(entries.begin(), entries, it->second);
+		}
+		else
+		{
+			entries.push_front({ key, std::move(value), weight });
+			index[key] = entries.begin();
+			totalWeight += weight;
+		}
+		evict(capacity);
+
+		return entries.front().value;
+	}
+
+	void setCapacity(size_t newCapacity)
+	{
+		capacity = newCapacity;
+		evict(capacity);
+	}
+
+	void clear()
+	{
+		entries.clear();
+		index.clear();
+		totalWeight = 0;
+	}
+
+	size_t size() const { return entries.size(); }
+	size_t weight() const { return totalWeight; }
+	size_t getCapacity() const { return capacity; }
+	const CacheStats& getStats() const { return stats; }
+
+private:
+	struct Entry
+	{
+		Key key;
+		Value value;
+		size_t weight;
+	};
+
+	void evict(size_t maxWeight)
+	{
+		//The most recent entry is never evicted so callers can always use what they just inserted
+		while (entries.size() > 1 && totalWeight > maxWeight)
+		{
+			totalWeight -= entries.back().weight;
+			index.erase(entries.back().key);
+			entries.pop_back();
+			stats.evictions++;
+		}
+	}
+
+	size_t capacity;
+	size_t totalWeight = 0;
+	std::list<Entry> entries; //most recently used first
+	std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index;
+	CacheStats stats;
+};
+
+}
@@ -0,0 +1,141 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "MappedFile.hpp"
+#include "fonttik/Log.h"
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tik
+{
+
+MappedFile::MappedFile(const std::string& path) : path(path)
+{
+	if (map())
+	{
+		return;
+	}
+
+	//Mapping is an optimization, fall back to a plain read
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Unable to open file " + path);
+	}
+
+	fileSize = static_cast<size_t>(file.tellg());
+	buffer.resize(fileSize);
+	file.seekg(0);
+	file.read(buffer.data(), fileSize);
+	LOG_CORE_DEBUG("{} could not be memory-mapped, loaded {} bytes into memory", path, fileSize);
+}
+
+MappedFile::~MappedFile()
+{
+	unmap();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::map()
+{
+	//Writers are allowed, e.g. the detection cache appends to the file it has mapped
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	mappedData = static_cast<const char*>(view);
+	fileSize = static_cast<size_t>(size.QuadPart);
+	return true;
+}
+
+void MappedFile::unmap()
+{
+	if (mappedData != nullptr)
+	{
+		UnmapViewOfFile(mappedData);
+		CloseHandle(mappingHandle);
+		CloseHandle(fileHandle);
+		mappedData = nullptr;
+	}
+}
+
+#else
+
+bool MappedFile::map()
+{
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	void* view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	//The mapping keeps its own reference to the file
+	close(fd);
+
+	if (view == MAP_FAILED)
+	{
+		return false;
+	}
+
+	mappedData = static_cast<const char*>(view);
+	fileSize = static_cast<size_t>(fileStat.st_size);
+	return true;
+}
+
+void MappedFile::unmap()
+{
+	if (mappedData != nullptr)
+	{
+		munmap(const_cast<char*>(mappedData), fileSize);
+		mappedData = nullptr;
+	}
+}
+
+#endif
+
+}
@@ -0,0 +1,44 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace tik
+{
+
+/// <summary>
+/// Read-only view of a whole file. The file is memory-mapped so its pages are shared with any other
+/// process mapping the same file, if mapping fails the contents are read into memory instead.
+/// </summary>
+class MappedFile
+{
+public:
+	MappedFile(const std::string& path);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	inline const char* data() const { return mappedData != nullptr ? mappedData : buffer.data(); }
+	inline size_t size() const { return fileSize; }
+	inline bool isMapped() const { return mappedData != nullptr; }
+	inline const std::string& getPath() const { return path; }
+
+private:
+	bool map();
+	void unmap();
+
+	std::string path;
+	const char* mappedData = nullptr;
+	size_t fileSize = 0;
+	std::vector<char> buffer; //fallback storage when the file can't be mapped
+
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#endif
+};
+
+}
@@ -3,6 +3,7 @@
 #include "fonttik/Media.hpp"
 #include "Video.hpp"
 #include "Image.hpp"
+#include "fonttik/ImageSequence.hpp"
 #include "fonttik/Log.h"
 #include "fonttik/ConfigurationParams.hpp"
 
@@ -15,6 +16,12 @@ Media* Media::createMedia(std::string mediaSource, ColorblindFilters* colorblind
 {
 	Media* media = nullptr;
 
+	//printf-style patterns such as frame_%05d.png are image sequences
+	if (!fs::exists(mediaSource) && ImageSequence::isPattern(mediaSource))
+	{
+		return ImageSequence::fromPattern(mediaSource);
+	}
+
 	//Attempt to open file as image, if not possible then try as video
 	cv::Mat img = cv::imread(mediaSource, cv::IMREAD_COLOR);
 	
@@ -66,12 +73,122 @@ void Media::calculateMask(const MaskParams& maskParams)
 	}
 }
 
+cv::Rect Media::findContentRect(const cv::Mat& frame, int threshold)
+{
+	cv::Mat gray;
+	if (frame.channels() == 1)
+	{
+		gray = frame;
+	}
+	else
+	{
+		cv::cvtColor(frame, gray, (frame.channels() == 4) ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+	}
+
+	//Brightest pixel of each row and column, borders are the outer rows and columns that stay dark
+	cv::Mat rowMax, colMax;
+	cv::reduce(gray, rowMax, 1, cv::REDUCE_MAX);
+	cv::reduce(gray, colMax, 0, cv::REDUCE_MAX);
+
+	auto firstAbove = [threshold](const uchar* values, int count, int step)
+		{
+			int i = (step > 0) ? 0 : count - 1;
+			for (; i >= 0 && i < count; i += step)
+			{
+				if (values[i] > threshold)
+				{
+					break;
+				}
+			}
+			return i;
+		};
+
+	const int top = firstAbove(rowMax.ptr<uchar>(), rowMax.rows, 1);
+	if (top == rowMax.rows)
+	{
+		return {};
+	}
+	const int bottom = firstAbove(rowMax.ptr<uchar>(), rowMax.rows, -1);
+	const int left = firstAbove(colMax.ptr<uchar>(), colMax.cols, 1);
+	const int right = firstAbove(colMax.ptr<uchar>(), colMax.cols, -1);
+
+	//Thin dark edges are usually encoding artifacts, only crop borders that save a meaningful amount of pixels
+	const int minBorder = 8;
+	cv::Rect content(left < minBorder ? 0 : left, top < minBorder ? 0 : top, 0, 0);
+	content.width = ((frame.cols - 1 - right < minBorder) ? frame.cols : right + 1) - content.x;
+	content.height = ((frame.rows - 1 - bottom < minBorder) ? frame.rows : bottom + 1) - content.y;
+
+	return content;
+}
+
+bool Media::bordersAreUniform(const cv::Mat& frame, const cv::Rect& content) const
+{
+	const cv::Rect strips[] = {
+		cv::Rect(0, 0, frame.cols, content.y),
+		cv::Rect(0, content.br().y, frame.cols, frame.rows - content.br().y),
+		cv::Rect(0, content.y, content.x, content.height),
+		cv::Rect(content.br().x, content.y, frame.cols - content.br().x, content.height)
+	};
+
+	for (const cv::Rect& strip : strips)
+	{
+		if (strip.empty())
+		{
+			continue;
+		}
+
+		//Channels are checked independently, a border pixel has every channel under the threshold
+		double maxValue;
+		cv::minMaxLoc(frame(strip).reshape(1), nullptr, &maxValue);
+		if (maxValue > borderThreshold)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void Media::updateContentRect(const cv::Mat& frame)
+{
+	if (!autoCrop || frame.empty())
+	{
+		contentRect = {};
+		return;
+	}
+
+	if (!contentRect.empty() && (cv::Rect(0, 0, frame.cols, frame.rows) & contentRect) == contentRect && bordersAreUniform(frame, contentRect))
+	{
+		return;
+	}
+
+	cv::Rect previous = contentRect;
+	contentRect = findContentRect(frame, borderThreshold);
+
+	if (contentRect != previous && !contentRect.empty())
+	{
+		LOG_CORE_DEBUG("Analysing frame content at {}x{}+{}+{} out of {}x{}", contentRect.width, contentRect.height, contentRect.x, contentRect.y,
+			frame.cols, frame.rows);
+	}
+}
+
 void Media::saveOutputData(cv::Mat data, fs::path path) 
 {
 	cv::imwrite(path.string(), data);
 }
 
 fs::path Media::getOutputPath() 
+{
+	fs::path outputPath = getOutputPath(mediaSource);
+	if (!fs::is_directory(outputPath) || !fs::exists(outputPath)) 
+	{
+		fs::create_directory(outputPath);
+	}
+
+	return outputPath;
+}
+
+fs::path Media::getOutputPath(const std::string& mediaSource)
 {
 	fs::path path{ mediaSource };
 
@@ -87,13 +204,7 @@ fs::path Media::getOutputPath()
 		out = { std::string{"./output/"} };
 	}
 	
-	fs::path outputPath = fs::path{ out };
-	if (!fs::is_directory(outputPath) || !fs::exists(outputPath)) 
-	{
-		fs::create_directory(outputPath);
-	}
-
-	return outputPath;
+	return fs::path{ out };
 }
 
 }//Namespace close bracket
\ No newline at end of file
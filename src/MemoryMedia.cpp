@@ -0,0 +1,207 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/MemoryMedia.hpp"
+#include "fonttik/Log.h"
+#include "Video.hpp"
+#include <opencv2/imgproc.hpp>
+#include <fstream>
+
+namespace tik
+{
+
+MemoryMedia::MemoryMedia(std::string name, cv::Size frameSize, ColorblindFilters* colorblindFilters) : Media(name),
+	colorblindFilters(colorblindFilters)
+{
+	imageSize = frameSize;
+}
+
+cv::Mat MemoryMedia::wrapBuffer(const FrameBuffer& buffer)
+{
+	if (buffer.data == nullptr || buffer.width <= 0 || buffer.height <= 0)
+	{
+		return {};
+	}
+
+	const int channels = (buffer.format == PixelFormat::BGR) ? 3 : 4;
+	if (buffer.stride != 0 && buffer.stride < static_cast<size_t>(buffer.width) * channels)
+	{
+		LOG_CORE_ERROR("Frame stride {} is shorter than a row of {} pixels", buffer.stride, buffer.width);
+		return {};
+	}
+
+	//The Mat only points at the caller's memory, analysis never writes to the frame
+	cv::Mat view(buffer.height, buffer.width, CV_8UC(channels), const_cast<uint8_t*>(buffer.data),
+		(buffer.stride != 0) ? buffer.stride : cv::Mat::AUTO_STEP);
+
+	if (buffer.format == PixelFormat::BGR)
+	{
+		return view;
+	}
+
+	cv::Mat bgr;
+	cv::cvtColor(view, bgr, (buffer.format == PixelFormat::BGRA) ? cv::COLOR_BGRA2BGR : cv::COLOR_RGBA2BGR);
+	return bgr;
+}
+
+bool MemoryMedia::pushFrame(const FrameBuffer& buffer)
+{
+	return pushFrame(wrapBuffer(buffer), buffer.frameIndex, buffer.msTimeStamp);
+}
+
+bool MemoryMedia::pushFrame(const cv::Mat& image, int frameIndex, int msTimeStamp)
+{
+	if (image.empty() || image.size() != imageSize)
+	{
+		LOG_CORE_ERROR("Frame {} of {} doesn't match the media size {}x{}", frameIndex, mediaSource, imageSize.width, imageSize.height);
+		return false;
+	}
+
+	if (image.channels() == 3)
+	{
+		pendingFrame = image;
+	}
+	else
+	{
+		cv::cvtColor(image, pendingFrame, (image.channels() == 4) ? cv::COLOR_BGRA2BGR : cv::COLOR_GRAY2BGR);
+	}
+
+	pendingIndex = frameIndex;
+	pendingTimeStamp = msTimeStamp;
+	hasPendingFrame = true;
+	return true;
+}
+
+bool MemoryMedia::loadFrame()
+{
+	if (!hasPendingFrame)
+	{
+		return false;
+	}
+
+	currentFrame = pendingFrame;
+	frameIndex = pendingIndex;
+	msTimeStamp = pendingTimeStamp;
+
+	pendingFrame.release();
+	hasPendingFrame = false;
+	return true;
+}
+
+Frame MemoryMedia::getFrame()
+{
+	updateContentRect(currentFrame);
+
+	Frame frame(currentFrame, mask, frameIndex, msTimeStamp);
+	frame.setContentRect(contentRect);
+	return frame;
+}
+
+std::vector<Frame> MemoryMedia::getColorblindFrames()
+{
+	if (colorblindFilters == nullptr || currentFrame.empty())
+	{
+		return {};
+	}
+
+	std::vector<Frame> frames;
+	for (const cv::Mat& filtered : colorblindFilters->applyColorblindFilters(currentFrame))
+	{
+		frames.emplace_back(filtered, mask, frameIndex);
+		frames.back().setContentRect(contentRect);
+	}
+	return frames;
+}
+
+std::pair<fs::path, fs::path> MemoryMedia::saveResultsOutlines(const SaveResultProperties& sizeResultProperties,
+	const SaveResultProperties& contrastResultProperties)
+{
+	if (sizeResultProperties.results.empty() || contrastResultProperties.results.empty())
+	{
+		return {};
+	}
+
+	return
+	{
+		saveResultsOutlines(currentFrame, sizeResultProperties.results.back(), sizeResultProperties.path, sizeResultProperties.colors,
+			sizeResultProperties.saveNumbers, false),
+		saveResultsOutlines(currentFrame, contrastResultProperties.results.back(), contrastResultProperties.path, contrastResultProperties.colors,
+			contrastResultProperties.saveNumbers, true)
+	};
+}
+
+void MemoryMedia::saveResultsOutlinesAsync(const SaveResultProperties& sizeResultProperties,
+	const SaveResultProperties& contrastResultProperties, rigtorp::SPSCQueue<FrameResult>& queue, std::atomic<bool>& done)
+{
+	//Results are stored as a video's, with the frame index and time stamp of every frame
+	fs::path outputPath = getOutputPath();
+	std::ofstream outSizeJson(outputPath / "sizeChecks.json");
+	std::ofstream outContrastJson(outputPath / "contrastChecks.json");
+	outSizeJson << "[\n";
+	outContrastJson << "[\n";
+
+	//Frames belong to the caller and may be gone by the time their results arrive, each result carries a copy of its frame
+	bool stored = false;
+	while (!(queue.empty() && done))
+	{
+		if (queue.front())
+		{
+			FrameResult current = *queue.front();
+			queue.pop();
+
+			//Frames whose analysis was skipped have no index in their results, their position in the analysis still names them
+			const int index = (current.size.frame >= 0) ? current.size.frame : current.frameID;
+			saveResultsOutlines(current.frame, current.size, getFramePath(sizeResultProperties.path, index), sizeResultProperties.colors,
+				sizeResultProperties.saveNumbers, false);
+			saveResultsOutlines(current.frame, current.contrast, getFramePath(contrastResultProperties.path, index),
+				contrastResultProperties.colors, contrastResultProperties.saveNumbers, true);
+			Video::storeResultsInJSON(current.size, index, current.timeStamp, outSizeJson);
+			Video::storeResultsInJSON(current.contrast, index, current.timeStamp, outContrastJson, true);
+			stored = true;
+		}
+	}
+
+	//Drops the separator after the last frame
+	if (stored)
+	{
+		outSizeJson.seekp((long)outSizeJson.tellp() - 2l);
+		outContrastJson.seekp((long)outContrastJson.tellp() - 2l);
+	}
+	outSizeJson << "]\n";
+	outContrastJson << "]\n";
+}
+
+fs::path MemoryMedia::getFramePath(const fs::path& path, int frameIndex)
+{
+	return path.parent_path() / (path.stem().string() + "_" + std::to_string(frameIndex) + path.extension().string());
+}
+
+fs::path MemoryMedia::saveResultsOutlines(const cv::Mat& frame, const FrameResults& results, const fs::path& path,
+	const std::vector<cv::Scalar>& colors, bool saveNumbers, bool contrast)
+{
+	if (frame.empty())
+	{
+		return {};
+	}
+
+	cv::Mat highlights = frame.clone();
+
+	for (const ResultBox& box : results.results)
+	{
+		cv::Scalar color = colors[box.type];
+		Frame::paintTextBox(box.x, box.y, box.width, box.height, color, highlights, 2);
+	}
+
+	//Add measurements after outline so it doesn't cover the numbers
+	if (saveNumbers)
+	{
+		for (const ResultBox& box : results.results)
+		{
+			Frame::paintTextBoxResultValues(highlights, box, box.value, contrast ? 1 : 0);
+		}
+	}
+
+	saveOutputData(highlights, path.string());
+	return path;
+}
+
+}
@@ -0,0 +1,89 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "ModelRegistry.hpp"
+#include "fonttik/Log.h"
+#include <atomic>
+
+namespace tik
+{
+
+//Context 0 is never created, it means the calling thread isn't bound to one
+static std::atomic<ModelRegistry::Context> nextContext{ 1 };
+
+//Inference context the calling thread has been bound to
+static thread_local ModelRegistry::Context boundContext = 0;
+
+ModelRegistry& ModelRegistry::getInstance()
+{
+	static ModelRegistry instance;
+	return instance;
+}
+
+ModelRegistry::Context ModelRegistry::createContext()
+{
+	return nextContext++;
+}
+
+ModelRegistry::Context ModelRegistry::currentContext()
+{
+	//Unlike thread ids, the context of a finished thread isn't given to the threads started after it
+	static thread_local Context threadContext = createContext();
+	return (boundContext != 0) ? boundContext : threadContext;
+}
+
+std::shared_ptr<cv::dnn::Net> ModelRegistry::getNet(const std::string& modelPath)
+{
+	const std::pair<std::string, Context> key = { modelPath, currentContext() };
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = contextNets.find(key);
+		if (it != contextNets.end())
+		{
+			if (std::shared_ptr<cv::dnn::Net> net = it->second.lock())
+			{
+				LOG_CORE_DEBUG("Reusing network for {}", key.first);
+				return net;
+			}
+		}
+	}
+
+	//Parsing is done without holding the lock so different models can be loaded concurrently
+	std::shared_ptr<cv::dnn::Net> net = std::make_shared<cv::dnn::Net>(cv::dnn::readNet(modelPath));
+	LOG_CORE_DEBUG("Loaded network for {}", modelPath);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	//Forget networks whose users are gone
+	for (auto it = contextNets.begin(); it != contextNets.end();)
+	{
+		it = it->second.expired() ? contextNets.erase(it) : std::next(it);
+	}
+
+	std::weak_ptr<cv::dnn::Net>& slot = contextNets[key];
+	if (std::shared_ptr<cv::dnn::Net> existing = slot.lock())
+	{
+		//Another scope bound to this context loaded it first
+		return existing;
+	}
+	slot = net;
+
+	return net;
+}
+
+void ModelRegistry::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	contextNets.clear();
+}
+
+ModelRegistry::ContextScope::ContextScope(Context context) : previousContext(boundContext)
+{
+	boundContext = context;
+}
+
+ModelRegistry::ContextScope::~ContextScope()
+{
+	boundContext = previousContext;
+}
+
+}
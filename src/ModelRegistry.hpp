@@ -0,0 +1,71 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <opencv2/dnn.hpp>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace tik
+{
+
+/// <summary>
+/// Process wide registry of the networks used by Fonttik.
+/// Networks are handed out per inference context, every detector or recogniser working on the same context shares a single network
+/// and its weights. Each Fonttik binds its own context, threads that aren't bound to one are their own context. OpenCV networks are
+/// not thread-safe, different contexts always get different networks, and OpenCV gives each network its own copy of the weights, so
+/// memory grows with every context running a model. Contexts are never
+/// reused, so a network kept by an object that outlives its thread is never handed to another thread.
+/// </summary>
+class ModelRegistry
+{
+public:
+	using Context = uint64_t;
+
+	static ModelRegistry& getInstance();
+
+	/// <summary>
+	/// Returns a new inference context no network has been loaded for
+	/// </summary>
+	static Context createContext();
+
+	/// <summary>
+	/// Returns the network of the current inference context for the given model, loading it if needed.
+	/// The network is released once every holder of the returned pointer is gone.
+	/// </summary>
+	std::shared_ptr<cv::dnn::Net> getNet(const std::string& modelPath);
+
+	/// <summary>
+	/// Forgets the networks handed out, networks still in use are not affected
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Binds the calling thread to an inference context while in scope, e.g. the context of the Fonttik it is running or loading
+	/// models for.
+	/// </summary>
+	class ContextScope
+	{
+	public:
+		ContextScope(Context context);
+		~ContextScope();
+
+		ContextScope(const ContextScope&) = delete;
+		ContextScope& operator=(const ContextScope&) = delete;
+
+	private:
+		Context previousContext;
+	};
+
+private:
+	ModelRegistry() {};
+
+	static Context currentContext();
+
+	std::mutex mutex;
+	std::map<std::pair<std::string, Context>, std::weak_ptr<cv::dnn::Net>> contextNets;
+};
+
+}
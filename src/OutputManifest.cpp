@@ -0,0 +1,111 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/OutputManifest.hpp"
+#include "fonttik/Log.h"
+#include "MappedFile.hpp"
+#include "ContentHash.hpp"
+#include <nlohmann/json.hpp>
+#include <fstream>
+
+#ifndef FONTTIK_VERSION
+#define FONTTIK_VERSION "unknown"
+#endif
+
+namespace tik
+{
+
+using json = nlohmann::json;
+
+//Results that have to be present for a media to count as analysed
+static const char* REQUIRED_OUTPUTS[] = { "sizeChecks.json", "contrastChecks.json" };
+
+OutputManifest::OutputManifest(const fs::path& input, uint64_t configHash) : input(input), configHash(configHash)
+{
+	std::error_code error;
+	size = fs::file_size(input, error);
+	modificationTime = static_cast<int64_t>(fs::last_write_time(input, error).time_since_epoch().count());
+}
+
+std::string OutputManifest::getLibraryVersion()
+{
+	return FONTTIK_VERSION;
+}
+
+std::string OutputManifest::toHex(uint64_t value)
+{
+	char buffer[17];
+	snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+	return buffer;
+}
+
+uint64_t OutputManifest::getContentHash()
+{
+	if (!hasContentHash)
+	{
+		contentHash = (size == 0) ? CONTENT_HASH_SEED : hashBytes(MappedFile(input.string()).data(), size);
+		hasContentHash = true;
+	}
+	return contentHash;
+}
+
+bool OutputManifest::isUpToDate(const fs::path& outputPath)
+{
+	for (const char* output : REQUIRED_OUTPUTS)
+	{
+		if (!fs::exists(outputPath / output))
+		{
+			return false;
+		}
+	}
+
+	json stored;
+	try
+	{
+		std::ifstream file(outputPath / FILE_NAME);
+		if (!file.is_open())
+		{
+			return false;
+		}
+		stored = json::parse(file);
+
+		if (stored.value("version", std::string()) != getLibraryVersion() || stored.value("configHash", std::string()) != toHex(configHash) ||
+			stored.value("size", uintmax_t(0)) != size)
+		{
+			return false;
+		}
+
+		//Same size and time is trusted without reading the file, the hash catches touched or copied files with the same contents
+		if (stored.value("modificationTime", int64_t(0)) == modificationTime)
+		{
+			return true;
+		}
+		if (stored.value("contentHash", std::string()) != toHex(getContentHash()))
+		{
+			return false;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		LOG_CORE_DEBUG("Ignoring unreadable manifest in {}: {}", outputPath.string(), e.what());
+		return false;
+	}
+
+	save(outputPath);
+	return true;
+}
+
+void OutputManifest::save(const fs::path& outputPath)
+{
+	json manifest;
+	manifest["input"] = input.filename().string();
+	manifest["size"] = size;
+	manifest["modificationTime"] = modificationTime;
+	manifest["contentHash"] = toHex(getContentHash());
+	manifest["configHash"] = toHex(configHash);
+	manifest["version"] = getLibraryVersion();
+
+	std::ofstream out(outputPath / FILE_NAME);
+	out << manifest.dump(4);
+}
+
+}
@@ -0,0 +1,71 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "RealTimeController.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+
+namespace tik
+{
+
+RealTimeController::RealTimeController(const PerformanceParams& params) : budgetMs(params.frameBudgetMs)
+{
+	setAvailableStages(DEGRADED_COLORBLIND | DEGRADED_RECOGNITION | DEGRADED_DETECTION);
+}
+
+void RealTimeController::setAvailableStages(unsigned stages)
+{
+	levels.clear();
+	for (unsigned degraded : LEVELS)
+	{
+		if (levels.empty() || (degraded & stages) != levels.back())
+		{
+			levels.push_back(degraded & stages);
+		}
+	}
+	setLevel(0);
+}
+
+void RealTimeController::frameFinished(double milliseconds)
+{
+	stats.frames++;
+	stats.framesOverBudget += (milliseconds > budgetMs) ? 1 : 0;
+	stats.degradedFrames += (levels[level] != DEGRADED_NONE) ? 1 : 0;
+	stats.averageMs = (stats.frames == 1) ? milliseconds : stats.averageMs + SMOOTHING * (milliseconds - stats.averageMs);
+
+	levelAverageMs = (levelFrames++ == 0) ? milliseconds : levelAverageMs + SMOOTHING * (milliseconds - levelAverageMs);
+
+	if (levelAverageMs > budgetMs)
+	{
+		framesUnderBudget = 0;
+		if (level + 1 < static_cast<int>(levels.size()))
+		{
+			setLevel(level + 1);
+		}
+	}
+	else if (levelAverageMs < budgetMs * RESTORE_RATIO)
+	{
+		if (++framesUnderBudget >= RESTORE_FRAMES && level > 0)
+		{
+			setLevel(level - 1);
+		}
+	}
+	else
+	{
+		framesUnderBudget = 0;
+	}
+}
+
+void RealTimeController::setLevel(int newLevel)
+{
+	if (newLevel != level)
+	{
+		LOG_CORE_DEBUG("Real-time analysis averages {:.1f} ms per frame for a {:.1f} ms budget, {} stages", levelAverageMs, budgetMs,
+			(newLevel > level) ? "degrading" : "restoring");
+	}
+
+	level = newLevel;
+	levelFrames = 0;
+	framesUnderBudget = 0;
+}
+
+}
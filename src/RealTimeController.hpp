@@ -0,0 +1,67 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include "fonttik/Metrics.hpp"
+#include "fonttik/Results.h"
+#include <vector>
+
+namespace tik
+{
+
+struct PerformanceParams;
+
+/// <summary>
+/// Decides which stages real-time mode degrades on each frame to keep analysis within the frame budget.
+/// Stages are degraded one level at a time while the smoothed analysis time is over budget, and restored one level
+/// at a time once it has stayed well under it. Decisions only use frames analysed at the current level. Levels that would only
+/// degrade stages the media doesn't run are skipped.
+/// </summary>
+class RealTimeController
+{
+public:
+	RealTimeController(const PerformanceParams& params);
+
+	/// <summary>
+	/// Stages to degrade on the next frame, as DegradedStage flags
+	/// </summary>
+	unsigned planFrame() const { return levels[level]; }
+
+	/// <summary>
+	/// Sets the stages the media runs, as DegradedStage flags, e.g. without colorblind frames there is nothing to gain from skipping them.
+	/// Starts over from the undegraded level.
+	/// </summary>
+	void setAvailableStages(unsigned stages);
+
+	/// <summary>
+	/// Reports how long the last planned frame took to analyse
+	/// </summary>
+	void frameFinished(double milliseconds);
+
+	RealTimeStats getStats() const { return stats; }
+
+private:
+	void setLevel(int newLevel);
+
+	//Cheapest stages to lose go first, coarse detection is the last resort as it can miss text
+	static constexpr unsigned LEVELS[] = {
+		DEGRADED_NONE,
+		DEGRADED_COLORBLIND,
+		DEGRADED_COLORBLIND | DEGRADED_RECOGNITION,
+		DEGRADED_COLORBLIND | DEGRADED_RECOGNITION | DEGRADED_DETECTION
+	};
+
+	std::vector<unsigned> levels; //LEVELS that degrade a stage the media runs
+
+	const double SMOOTHING = 0.3; //Weight of the newest frame in the smoothed times
+	const double RESTORE_RATIO = 0.5; //Share of the budget analysis has to stay under to restore a stage
+	const int RESTORE_FRAMES = 10; //Frames analysis has to stay under that share before restoring
+
+	double budgetMs;
+	int level = 0;
+	int levelFrames = 0; //Frames analysed at the current level
+	double levelAverageMs = 0;
+	int framesUnderBudget = 0;
+	RealTimeStats stats;
+};
+
+}
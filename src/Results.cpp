@@ -17,6 +17,39 @@ tik::ResultType tik::ResultTypeMerge(const ResultType a, const ResultType b)
 	}
 }
 
+std::vector<std::string> tik::DegradedStagesAsStrings(unsigned stages)
+{
+	std::vector<std::string> names;
+	if (stages & DEGRADED_COLORBLIND)
+	{
+		names.push_back("colorblind");
+	}
+	if (stages & DEGRADED_RECOGNITION)
+	{
+		names.push_back("recognition");
+	}
+	if (stages & DEGRADED_DETECTION)
+	{
+		names.push_back("detection");
+	}
+	return names;
+}
+
+void tik::FrameResults::addResult(const ResultBox& box, bool mergeTypes)
+{
+	results.push_back(box);
+	overallPass = overallPass && box.passes;
+	if (mergeTypes)
+	{
+		overallType = ResultTypeMerge(overallType, box.type);
+		for (size_t i = 0; i < box.colorblindTypes.size() && i < overallColorblindType.size(); i++)
+		{
+			overallColorblindPass[i] = overallColorblindPass[i] && box.colorblindTypes[i] == ResultType::PASS;
+			overallColorblindType[i] = ResultTypeMerge(overallColorblindType[i], box.colorblindTypes[i]);
+		}
+	}
+}
+
 std::string tik::ResultTypeAsString(ResultType t)
 {
 	 switch (t)
@@ -0,0 +1,451 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/SharedFrameRing.hpp"
+#include "fonttik/Log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace tik
+{
+
+static const uint32_t RING_MAGIC = 0x4B54464D; //"MFTK"
+static const uint32_t RING_VERSION = 1;
+static const uint32_t NO_SLOT = UINT32_MAX;
+static const size_t RING_ALIGNMENT = 64; //rows and slots start on their own cache line
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+	"Shared memory atomics must be lock free to work across processes");
+
+//Layout shared with the other process, only add fields at the end and bump RING_VERSION
+struct SharedFrameRing::Header
+{
+	std::atomic<uint32_t> magic; //set last by the writer, once everything else is initialized
+	uint32_t version;
+	uint32_t width;
+	uint32_t height;
+	uint32_t format;
+	uint32_t slotCount;
+	uint64_t stride;
+	uint64_t slotSize;
+	uint64_t dataOffset;
+	std::atomic<uint32_t> latestSlot; //slot of the newest frame, NO_SLOT until the first one is published
+	std::atomic<uint32_t> readerSlot; //slot the reader is analysing, NO_SLOT if none
+	std::atomic<uint32_t> wakeup; //futex word, bumped on every publish and on close
+	std::atomic<uint32_t> closed;
+};
+
+struct SharedFrameRing::Slot
+{
+	std::atomic<uint64_t> sequence; //0 while the slot is being written
+	int32_t frameIndex;
+	int32_t msTimeStamp;
+};
+
+static size_t alignUp(size_t value, size_t alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+#ifdef __linux__
+
+static void waitForChange(std::atomic<uint32_t>& word, uint32_t value, int timeoutMs)
+{
+	//Not a private futex, the word is shared with another process
+	timespec timeout{ timeoutMs / 1000, (timeoutMs % 1000) * 1000000L };
+	syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, value, &timeout, nullptr, 0);
+}
+
+static void wakeWaiters(std::atomic<uint32_t>& word)
+{
+	syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+#else
+
+static void waitForChange(std::atomic<uint32_t>& word, uint32_t value, int timeoutMs)
+{
+	//No portable way to wait on an address shared between processes, poll instead
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+	while (word.load() == value && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+static void wakeWaiters(std::atomic<uint32_t>&) {}
+
+#endif
+
+SharedFrameRing::SharedFrameRing(const std::string& ringName, bool owner) : owner(owner)
+{
+#ifdef _WIN32
+	name = (!ringName.empty() && ringName[0] == '/') ? ringName.substr(1) : ringName;
+#else
+	//POSIX shared memory names start with a slash
+	name = (!ringName.empty() && ringName[0] == '/') ? ringName : "/" + ringName;
+#endif
+}
+
+std::unique_ptr<SharedFrameRing> SharedFrameRing::create(const std::string& name, int width, int height, PixelFormat format, uint32_t slots)
+{
+	if (width <= 0 || height <= 0 || slots < MIN_SLOTS)
+	{
+		LOG_CORE_ERROR("Invalid shared frame ring {}: {}x{} with {} slots, at least {} are needed", name, width, height, slots, MIN_SLOTS);
+		return nullptr;
+	}
+
+	const size_t stride = alignUp(static_cast<size_t>(width) * ((format == PixelFormat::BGR) ? 3 : 4), RING_ALIGNMENT);
+	const size_t slotSize = alignUp(sizeof(Slot), RING_ALIGNMENT) + alignUp(stride * height, RING_ALIGNMENT);
+	const size_t dataOffset = alignUp(sizeof(Header), RING_ALIGNMENT);
+
+	std::unique_ptr<SharedFrameRing> ring(new SharedFrameRing(name, true));
+	if (!ring->map(dataOffset + slotSize * slots))
+	{
+		LOG_CORE_ERROR("Shared memory {} could not be created", ring->name);
+		return nullptr;
+	}
+
+	Header* header = new (ring->header) Header();
+	header->version = RING_VERSION;
+	header->width = width;
+	header->height = height;
+	header->format = static_cast<uint32_t>(format);
+	header->slotCount = slots;
+	header->stride = stride;
+	header->slotSize = slotSize;
+	header->dataOffset = dataOffset;
+	header->latestSlot = NO_SLOT;
+	header->readerSlot = NO_SLOT;
+	for (uint32_t i = 0; i < slots; i++)
+	{
+		new (&ring->slotAt(i)) Slot();
+	}
+	header->magic.store(RING_MAGIC, std::memory_order_release);
+
+	return ring;
+}
+
+std::unique_ptr<SharedFrameRing> SharedFrameRing::open(const std::string& name)
+{
+	std::unique_ptr<SharedFrameRing> ring(new SharedFrameRing(name, false));
+	if (!ring->map(0))
+	{
+		LOG_CORE_ERROR("Shared memory {} could not be opened", ring->name);
+		return nullptr;
+	}
+
+	const Header* header = ring->header;
+	if (ring->mappedSize < sizeof(Header) || header->magic.load(std::memory_order_acquire) != RING_MAGIC || header->version != RING_VERSION ||
+		ring->mappedSize < header->dataOffset + header->slotSize * header->slotCount)
+	{
+		LOG_CORE_ERROR("Shared memory {} is not a frame ring written by this version", ring->name);
+		return nullptr;
+	}
+
+	return ring;
+}
+
+SharedFrameRing::~SharedFrameRing()
+{
+	if (header != nullptr)
+	{
+		if (owner)
+		{
+			close();
+		}
+		else
+		{
+			release();
+		}
+	}
+	unmap();
+}
+
+SharedFrameRing::Slot& SharedFrameRing::slotAt(uint32_t slot) const
+{
+	return *reinterpret_cast<Slot*>(reinterpret_cast<uint8_t*>(header) + header->dataOffset + header->slotSize * slot);
+}
+
+uint8_t* SharedFrameRing::pixelsAt(uint32_t slot) const
+{
+	return reinterpret_cast<uint8_t*>(&slotAt(slot)) + alignUp(sizeof(Slot), RING_ALIGNMENT);
+}
+
+uint8_t* SharedFrameRing::beginWrite()
+{
+	const uint32_t latest = header->latestSlot.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < header->slotCount; i++)
+	{
+		const uint32_t candidate = (nextSlot + i) % header->slotCount;
+		if (candidate == latest)
+		{
+			continue;
+		}
+
+		//Claim the slot and then check the reader didn't pin it. The reader pins and then checks the sequence,
+		//so with both sequentially consistent at least one of them sees the other and backs off
+		Slot& slot = slotAt(candidate);
+		const uint64_t previous = slot.sequence.exchange(0);
+		if (header->readerSlot.load() == candidate)
+		{
+			slot.sequence.store(previous);
+			continue;
+		}
+
+		writingSlot = candidate;
+		nextSlot = (candidate + 1) % header->slotCount;
+		return pixelsAt(candidate);
+	}
+
+	//Unreachable with MIN_SLOTS slots, at most the newest and the pinned slot are taken
+	throw std::runtime_error("No free slot in shared frame ring " + name);
+}
+
+void SharedFrameRing::endWrite(int frameIndex, int msTimeStamp)
+{
+	Slot& slot = slotAt(writingSlot);
+	slot.frameIndex = frameIndex;
+	slot.msTimeStamp = msTimeStamp;
+	slot.sequence.store(++writeSequence, std::memory_order_release);
+
+	header->latestSlot.store(writingSlot, std::memory_order_release);
+	header->wakeup.fetch_add(1, std::memory_order_release);
+	wakeWaiters(header->wakeup);
+}
+
+void SharedFrameRing::publish(const uint8_t* data, size_t stride, int frameIndex, int msTimeStamp)
+{
+	uint8_t* pixels = beginWrite();
+	const size_t rowSize = static_cast<size_t>(header->width) * ((getFormat() == PixelFormat::BGR) ? 3 : 4);
+	for (uint32_t row = 0; row < header->height; row++)
+	{
+		std::memcpy(pixels + row * header->stride, data + row * stride, rowSize);
+	}
+	endWrite(frameIndex, msTimeStamp);
+}
+
+void SharedFrameRing::close()
+{
+	header->closed.store(1, std::memory_order_release);
+	header->wakeup.fetch_add(1, std::memory_order_release);
+	wakeWaiters(header->wakeup);
+}
+
+bool SharedFrameRing::acquireLatest(FrameBuffer& frame, int timeoutMs)
+{
+	release();
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeoutMs, 0));
+	while (true)
+	{
+		const uint32_t wakeup = header->wakeup.load(std::memory_order_acquire);
+		const uint32_t latest = header->latestSlot.load(std::memory_order_acquire);
+		if (latest != NO_SLOT)
+		{
+			Slot& slot = slotAt(latest);
+			const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+			if (sequence > readSequence)
+			{
+				//Pin the slot, if the writer claimed it in the meantime the sequence has changed and a newer frame is coming
+				header->readerSlot.store(latest);
+				if (slot.sequence.load() == sequence)
+				{
+					if (readSequence != 0)
+					{
+						droppedFrames += sequence - readSequence - 1;
+					}
+					readSequence = sequence;
+					holdingSlot = true;
+
+					frame = FrameBuffer{ pixelsAt(latest), static_cast<int>(header->width), static_cast<int>(header->height),
+						static_cast<size_t>(header->stride), static_cast<PixelFormat>(header->format), slot.frameIndex, slot.msTimeStamp };
+					return true;
+				}
+				header->readerSlot.store(NO_SLOT);
+				continue;
+			}
+		}
+
+		if (header->closed.load(std::memory_order_acquire) != 0)
+		{
+			return false;
+		}
+
+		//Wake up now and then even without a timeout so a writer that died without closing the ring doesn't need a signal
+		int waitMs = 100;
+		if (timeoutMs >= 0)
+		{
+			auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+			if (remaining <= 0)
+			{
+				return false;
+			}
+			waitMs = static_cast<int>(std::min<long long>(remaining, waitMs));
+		}
+		waitForChange(header->wakeup, wakeup, waitMs);
+	}
+}
+
+void SharedFrameRing::release()
+{
+	if (holdingSlot)
+	{
+		header->readerSlot.store(NO_SLOT, std::memory_order_release);
+		holdingSlot = false;
+	}
+}
+
+int SharedFrameRing::getWidth() const
+{
+	return static_cast<int>(header->width);
+}
+
+int SharedFrameRing::getHeight() const
+{
+	return static_cast<int>(header->height);
+}
+
+PixelFormat SharedFrameRing::getFormat() const
+{
+	return static_cast<PixelFormat>(header->format);
+}
+
+size_t SharedFrameRing::getStride() const
+{
+	return static_cast<size_t>(header->stride);
+}
+
+#ifdef _WIN32
+
+bool SharedFrameRing::map(size_t size)
+{
+	HANDLE mapping = owner ?
+		CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+			static_cast<DWORD>(size & 0xFFFFFFFF), name.c_str()) :
+		OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+	if (mapping == nullptr)
+	{
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	if (view == nullptr)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+
+	if (size == 0)
+	{
+		MEMORY_BASIC_INFORMATION info;
+		VirtualQuery(view, &info, sizeof(info));
+		size = info.RegionSize;
+	}
+
+	mappingHandle = mapping;
+	header = static_cast<Header*>(view);
+	mappedSize = size;
+	return true;
+}
+
+void SharedFrameRing::unmap()
+{
+	//The mapping disappears with its last handle
+	if (header != nullptr)
+	{
+		UnmapViewOfFile(header);
+		CloseHandle(mappingHandle);
+		header = nullptr;
+	}
+}
+
+#else
+
+bool SharedFrameRing::map(size_t size)
+{
+	int fd = -1;
+	if (owner)
+	{
+		shm_unlink(name.c_str());
+		fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (fd >= 0 && ftruncate(fd, static_cast<off_t>(size)) != 0)
+		{
+			::close(fd);
+			shm_unlink(name.c_str());
+			return false;
+		}
+	}
+	else
+	{
+		fd = shm_open(name.c_str(), O_RDWR, 0);
+		struct stat fileStat;
+		if (fd >= 0 && fstat(fd, &fileStat) == 0)
+		{
+			size = static_cast<size_t>(fileStat.st_size);
+		}
+	}
+
+	if (fd < 0 || size == 0)
+	{
+		if (fd >= 0)
+		{
+			::close(fd);
+		}
+		return false;
+	}
+
+	void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	//The mapping keeps its own reference to the shared memory
+	::close(fd);
+
+	if (view == MAP_FAILED)
+	{
+		if (owner)
+		{
+			shm_unlink(name.c_str());
+		}
+		return false;
+	}
+
+	header = static_cast<Header*>(view);
+	mappedSize = size;
+	return true;
+}
+
+void SharedFrameRing::unmap()
+{
+	if (header != nullptr)
+	{
+		munmap(header, mappedSize);
+		header = nullptr;
+		if (owner)
+		{
+			shm_unlink(name.c_str());
+		}
+	}
+}
+
+#endif
+
+}
@@ -0,0 +1,40 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/SharedMemoryMedia.hpp"
+#include "fonttik/Log.h"
+
+namespace tik
+{
+
+SharedMemoryMedia* SharedMemoryMedia::open(const std::string& name, ColorblindFilters* colorblindFilters)
+{
+	std::unique_ptr<SharedFrameRing> ring = SharedFrameRing::open(name);
+	if (ring == nullptr)
+	{
+		return nullptr;
+	}
+
+	return new SharedMemoryMedia(std::move(ring), name, colorblindFilters);
+}
+
+SharedMemoryMedia::SharedMemoryMedia(std::unique_ptr<SharedFrameRing> frameRing, const std::string& name, ColorblindFilters* colorblindFilters) :
+	MemoryMedia(name, cv::Size(frameRing->getWidth(), frameRing->getHeight()), colorblindFilters), ring(std::move(frameRing))
+{
+}
+
+bool SharedMemoryMedia::loadFrame()
+{
+	//Acquiring the next frame lets the writer reuse the slot of the previous one
+	FrameBuffer frame;
+	if (!ring->acquireLatest(frame, timeoutMs))
+	{
+		//The slot of the last frame was released, the writer may be overwriting it already
+		releaseFrame();
+		LOG_CORE_DEBUG("No more frames in {}, {} frames were dropped", mediaSource, ring->getDroppedFrames());
+		return false;
+	}
+
+	return pushFrame(frame) && MemoryMedia::loadFrame();
+}
+
+}
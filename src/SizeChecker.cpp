@@ -6,6 +6,8 @@
 #include "fonttik/Log.h"
 #include "fonttik/Configuration.hpp"
 #include "fonttik/ConfigurationParams.hpp"
+#include "DetectionCache.hpp"
+#include "ContentHash.hpp"
 
 #include <regex>
 
@@ -14,7 +16,7 @@ const std::regex descenders("[gjpqy]"); //Characters with descenders
 
 namespace tik
 {
-	SizeChecker::SizeChecker(Configuration* config, ITextBoxRecognition* textboxRecognition) 
+	SizeChecker::SizeChecker(const Configuration* config, ITextBoxRecognition* textboxRecognition) 
 		: IChecker(config), textboxRecognition(textboxRecognition)
 	{
 	}
@@ -24,6 +26,11 @@ namespace tik
 		FrameResults sizeResults(frameIndex);
 		bool passes = true;
 
+		if (configuration->getTextSizeParams().useTextRecognition && recognitionEnabled)
+		{
+			recognizeText(textBoxes);
+		}
+
 		//Run size check for each textbox in image
 		for (TextBox& textBox : textBoxes)
 		{
@@ -49,10 +56,12 @@ namespace tik
 		
 		//If not using text recognition, text height is chekced by accepting word as full-height
 		std::string recognitionResult = textBox.getText();
-		if (configuration->getTextSizeParams().useTextRecognition)
+		if (configuration->getTextSizeParams().useTextRecognition && recognitionEnabled)
 		{
-			if(recognitionResult=="")
-				recognizeText(recognitionResult, textBox);
+			//Clean \r invalid characters
+			size_t pos{};
+			while (((pos = recognitionResult.find('\r')) != std::string::npos))
+				recognitionResult.erase(pos, 1);
 
 			//Check for ascender or descender presence with regex
 			bool hasAscender = std::regex_search(recognitionResult, ascenders);
@@ -61,7 +70,7 @@ namespace tik
 		}
 
 		//Check height
-		int minimumHeight = configuration->getTextSizeParams().activeGuideline->height;
+		int minimumHeight = guideline->height;
 
 		//Check for minimum height based on guidelines
 		if (measuredHeight < minimumHeight && canFail) 
@@ -86,19 +95,54 @@ namespace tik
 		//The min and max values for x and y work as offsets inside the textbox, that's why original boxRect has to be accounted for.
 		//-1 and +2 values to add margin accounting for the outline width
 		results.results.push_back(ResultBox(type, boxRect.x + textRect.x - 1, boxRect.y + textRect.y - 1, textRect.width + 2, textRect.height + 2, measuredHeight, recognitionResult));
+		results.results.back().passes = sizeResult;
 		return sizeResult;
 	}
 
-	void SizeChecker::recognizeText(std::string& recognitionResult, TextBox& textBox)
+	void SizeChecker::recognizeText(std::vector<TextBox>& textBoxes)
 	{
-		//Recognize word in region
-		recognitionResult = textboxRecognition->recognizeBox(textBox);
-		textBox.setText(recognitionResult);
-
-		//Clean \r invalid characters
-		size_t pos{};
-		while (((pos = recognitionResult.find('\r')) != std::string::npos))
-			recognitionResult.erase(pos, 1);
+		const bool lazy = configuration->getPerformanceParams().lazyTextRecognition;
+		const int minimumHeight = guideline->height;
+
+		std::vector<TextBox*> pending;
+		std::vector<uint64_t> pendingHashes;
+		for (TextBox& textBox : textBoxes)
+		{
+			if (textBox.getText() != "" || (lazy && textBox.getTextRect().height >= minimumHeight))
+			{
+				continue;
+			}
+
+			//Identical boxes recognized in previous runs are read from the cache
+			if (detectionCache != nullptr)
+			{
+				uint64_t boxHash = hashPixels(textBox.getSubMatrix());
+				std::optional<std::string> cachedText = detectionCache->getText(boxHash, recognitionHash);
+				if (cachedText.has_value())
+				{
+					textBox.setText(cachedText.value());
+					continue;
+				}
+				pendingHashes.push_back(boxHash);
+			}
+			pending.push_back(&textBox);
+		}
+
+		if (pending.empty())
+		{
+			return;
+		}
+
+		LOG_CORE_TRACE("Recognizing text of {0} out of {1} boxes", pending.size(), textBoxes.size());
+		std::vector<std::string> texts = textboxRecognition->recognizeBoxes(pending);
+		for (size_t i = 0; i < pending.size(); i++)
+		{
+			pending[i]->setText(texts[i]);
+			if (detectionCache != nullptr)
+			{
+				detectionCache->putText(pendingHashes[i], recognitionHash, texts[i]);
+			}
+		}
 	}
 
 }
\ No newline at end of file
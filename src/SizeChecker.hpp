@@ -3,28 +3,52 @@
 #pragma once
 #include "IChecker.h"
 #include "ITextboxRecognition.h"
+#include <cstdint>
+#include <memory>
 
 namespace tik
 {
 class TextBox;
 class TextSizeParams;
+struct SizeGuidelines;
 class Configuration;
+class DetectionCache;
 
 class SizeChecker : public IChecker
 {
 public:
-	SizeChecker(Configuration* config, ITextBoxRecognition* textboxRecognition);
+	SizeChecker(const Configuration* config, ITextBoxRecognition* textboxRecognition);
 	virtual ~SizeChecker() { textboxRecognition = nullptr; }
 
 	virtual FrameResults check(const int& frameIndex, std::vector<TextBox>& textBoxes) override;
 	virtual FrameResults check(const int& frameIndex, std::vector<TextBox>& textBoxes, std::vector<std::vector<TextBox>> colorblindBoxes) { return FrameResults(frameIndex); };
 
+	//Recognition can be created after the checker when OCR is enabled once Fonttik has been initialized
+	void setTextboxRecognition(ITextBoxRecognition* recognition) { textboxRecognition = recognition; }
+
+	//Size guideline of the media being analysed, set by Fonttik when an analysis starts
+	void setGuideline(const SizeGuidelines* activeGuideline) { guideline = activeGuideline; }
+
+	//Recognized text is looked up in and added to the cache, keyed by the box pixels and the recognition settings hash
+	void setDetectionCache(std::shared_ptr<DetectionCache> cache, uint64_t settingsHash) { detectionCache = cache; recognitionHash = settingsHash; }
+
+	//Real-time mode skips recognition on frames over budget, sizes are then checked as if it was disabled
+	void setRecognitionEnabled(bool enabled) { recognitionEnabled = enabled; }
+
 protected:
 	bool textBoxSizeCheck(TextBox& textBox, FrameResults& results);
 	
-	void recognizeText(std::string& recognitionResult, TextBox& textBox);
+	/// <summary>
+	/// Recognizes the text of the boxes that need it in a single batch. With lazy recognition only boxes under the size guideline
+	/// are recognized, their text decides between a fail and a warning while it has no effect on boxes that pass.
+	/// </summary>
+	void recognizeText(std::vector<TextBox>& textBoxes);
 
 	ITextBoxRecognition* textboxRecognition = nullptr;
+	const SizeGuidelines* guideline = nullptr;
+	std::shared_ptr<DetectionCache> detectionCache;
+	uint64_t recognitionHash = 0;
+	bool recognitionEnabled = true;
 
 };
 
@@ -0,0 +1,343 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "fonttik/StreamMedia.hpp"
+#include "fonttik/Log.h"
+#include "Video.hpp"
+#include <opencv2/imgproc.hpp>
+#include <cstring>
+#include <sstream>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace tik
+{
+
+static const char Y4M_MAGIC[] = "YUV4MPEG2";
+static const size_t MAX_HEADER_LENGTH = 4096; //y4m headers are a few dozen bytes, longer ones aren't y4m
+
+//Reads up to the end of the line, false if the stream ends first or the line is too long to be a header
+static bool readLine(std::FILE* input, std::string& line)
+{
+	line.clear();
+	for (int c = std::fgetc(input); c != EOF; c = std::fgetc(input))
+	{
+		if (c == '\n')
+		{
+			return true;
+		}
+		if (line.size() >= MAX_HEADER_LENGTH)
+		{
+			return false;
+		}
+		line.push_back(static_cast<char>(c));
+	}
+	return false;
+}
+
+StreamMedia* StreamMedia::open(const std::string& source, const StreamFormat& format, ColorblindFilters* colorblindFilters)
+{
+	std::FILE* input = nullptr;
+	if (source == "-")
+	{
+#ifdef _WIN32
+		//Text mode would translate line endings inside the frames
+		_setmode(_fileno(stdin), _O_BINARY);
+#endif
+		input = stdin;
+	}
+	else
+	{
+		input = std::fopen(source.c_str(), "rb");
+	}
+
+	if (input == nullptr)
+	{
+		LOG_CORE_ERROR("Stream {} could not be opened", source);
+		return nullptr;
+	}
+
+	cv::Size frameSize = format.frameSize;
+	double fps = format.fps;
+	Layout layout = Layout::Packed;
+
+	//Streams without a frame size must describe themselves
+	if (frameSize.empty())
+	{
+		char magic[sizeof(Y4M_MAGIC) - 1];
+		if (std::fread(magic, 1, sizeof(magic), input) != sizeof(magic) || std::memcmp(magic, Y4M_MAGIC, sizeof(magic)) != 0
+			|| !readY4MHeader(input, source, frameSize, fps, layout))
+		{
+			LOG_CORE_ERROR("Stream {} has no frame size and is not a y4m stream", source);
+			if (input != stdin)
+			{
+				std::fclose(input);
+			}
+			return nullptr;
+		}
+	}
+
+	return new StreamMedia(input, source, frameSize, fps, format.format, layout, colorblindFilters);
+}
+
+bool StreamMedia::readY4MHeader(std::FILE* input, const std::string& name, cv::Size& frameSize, double& fps, Layout& layout)
+{
+	std::string header;
+	if (!readLine(input, header))
+	{
+		return false;
+	}
+
+	layout = Layout::YUV420; //y4m default when there is no C parameter
+	std::istringstream parameters(header);
+	std::string parameter;
+	while (parameters >> parameter)
+	{
+		const std::string value = parameter.substr(1);
+		switch (parameter[0])
+		{
+		case 'W':
+			frameSize.width = std::atoi(value.c_str());
+			break;
+		case 'H':
+			frameSize.height = std::atoi(value.c_str());
+			break;
+		case 'F':
+		{
+			int numerator = 0, denominator = 0;
+			if (std::sscanf(value.c_str(), "%d:%d", &numerator, &denominator) == 2 && denominator > 0)
+			{
+				fps = static_cast<double>(numerator) / denominator;
+			}
+			break;
+		}
+		case 'C':
+			if (value == "420" || value == "420jpeg" || value == "420paldv" || value == "420mpeg2")
+			{
+				layout = Layout::YUV420;
+			}
+			else if (value == "422")
+			{
+				layout = Layout::YUV422;
+			}
+			else if (value == "444")
+			{
+				layout = Layout::YUV444;
+			}
+			else if (value == "mono")
+			{
+				layout = Layout::Gray;
+			}
+			else
+			{
+				LOG_CORE_ERROR("Stream {} has unsupported color space {}, only 8 bit 420, 422, 444 and mono are supported", name, value);
+				return false;
+			}
+			break;
+		default:
+			//Interlacing, aspect ratio and extensions don't matter for the analysis
+			break;
+		}
+	}
+
+	if (frameSize.width <= 0 || frameSize.height <= 0)
+	{
+		return false;
+	}
+
+	//Chroma is analysed as 4:2:0, which needs even sizes
+	if (layout != Layout::Gray && (frameSize.width % 2 != 0 || frameSize.height % 2 != 0))
+	{
+		LOG_CORE_ERROR("Stream {} is {}x{}, y4m streams with chroma need even frame sizes", name, frameSize.width, frameSize.height);
+		return false;
+	}
+
+	LOG_CORE_INFO("Reading y4m stream {}, {}x{} at {} fps", name, frameSize.width, frameSize.height, fps);
+	return true;
+}
+
+StreamMedia::StreamMedia(std::FILE* input, const std::string& name, cv::Size frameSize, double fps, PixelFormat format, Layout layout,
+	ColorblindFilters* colorblindFilters) :
+	MemoryMedia(name, frameSize, colorblindFilters), input(input), format(format), layout(layout), fps(fps)
+{
+	buffer.resize(getFrameBytes());
+}
+
+StreamMedia::~StreamMedia()
+{
+	if (input != stdin)
+	{
+		std::fclose(input);
+	}
+}
+
+size_t StreamMedia::getFrameBytes() const
+{
+	const size_t pixels = static_cast<size_t>(imageSize.width) * imageSize.height;
+	switch (layout)
+	{
+	case Layout::YUV420:
+		return pixels * 3 / 2;
+	case Layout::YUV422:
+		return pixels * 2;
+	case Layout::YUV444:
+		return pixels * 3;
+	case Layout::Gray:
+		return pixels;
+	default:
+		return pixels * ((format == PixelFormat::BGR) ? 3 : 4);
+	}
+}
+
+bool StreamMedia::read(uint8_t* data, size_t bytes)
+{
+	size_t total = 0;
+	while (total < bytes)
+	{
+		size_t count = std::fread(data + total, 1, bytes - total, input);
+		if (count == 0)
+		{
+			break;
+		}
+		total += count;
+	}
+
+	if (total != 0 && total != bytes)
+	{
+		LOG_CORE_WARNING("Stream {} ended in the middle of frame {}", mediaSource, nextFrame);
+	}
+	return total == bytes;
+}
+
+bool StreamMedia::readFrameHeader()
+{
+	if (layout == Layout::Packed)
+	{
+		return true;
+	}
+
+	std::string header;
+	if (!readLine(input, header))
+	{
+		return false;
+	}
+	if (header.compare(0, 5, "FRAME") != 0)
+	{
+		LOG_CORE_ERROR("Stream {} is missing the header of frame {}", mediaSource, nextFrame);
+		return false;
+	}
+	return true;
+}
+
+bool StreamMedia::skipFrame()
+{
+	if (!readFrameHeader() || !read(buffer.data(), buffer.size()))
+	{
+		return false;
+	}
+
+	nextFrame++;
+	return true;
+}
+
+bool StreamMedia::readFrame(cv::Mat& frame)
+{
+	const int width = imageSize.width, height = imageSize.height;
+
+	//BGR frames are read straight into their own Mat, the previous one may still be referenced by its results
+	if (layout == Layout::Packed && format == PixelFormat::BGR)
+	{
+		frame.create(height, width, CV_8UC3);
+		if (!read(frame.data, buffer.size()))
+		{
+			return false;
+		}
+		nextFrame++;
+		return true;
+	}
+
+	if (!skipFrame())
+	{
+		return false;
+	}
+
+	switch (layout)
+	{
+	case Layout::Packed:
+		frame = wrapBuffer(FrameBuffer{ buffer.data(), width, height, 0, format });
+		break;
+	case Layout::YUV420:
+		cv::cvtColor(cv::Mat(height * 3 / 2, width, CV_8UC1, buffer.data()), frame, cv::COLOR_YUV2BGR_I420);
+		break;
+	case Layout::Gray:
+		cv::cvtColor(cv::Mat(height, width, CV_8UC1, buffer.data()), frame, cv::COLOR_GRAY2BGR);
+		break;
+	default:
+	{
+		//Chroma is averaged down to 4:2:0 so every y4m stream is converted with the same range and matrix
+		const int chromaWidth = (layout == Layout::YUV444) ? width : width / 2;
+		const size_t lumaBytes = static_cast<size_t>(width) * height, chromaBytes = static_cast<size_t>(chromaWidth) * height;
+		const cv::Size halfSize(width / 2, height / 2);
+
+		i420.create(height * 3 / 2, width, CV_8UC1);
+		std::memcpy(i420.data, buffer.data(), lumaBytes);
+		cv::Mat u(halfSize, CV_8UC1, i420.data + lumaBytes);
+		cv::Mat v(halfSize, CV_8UC1, i420.data + lumaBytes + halfSize.area());
+		cv::resize(cv::Mat(height, chromaWidth, CV_8UC1, buffer.data() + lumaBytes), u, halfSize, 0, 0, cv::INTER_AREA);
+		cv::resize(cv::Mat(height, chromaWidth, CV_8UC1, buffer.data() + lumaBytes + chromaBytes), v, halfSize, 0, 0, cv::INTER_AREA);
+		cv::cvtColor(i420, frame, cv::COLOR_YUV2BGR_I420);
+		break;
+	}
+	}
+	return !frame.empty();
+}
+
+bool StreamMedia::loadFrame()
+{
+	if (nextFrame > 0)
+	{
+		//Frames skipped by configuration and the ones real-time mode drops are read past, the same frames as in a video are picked
+		const int candidate = Video::nextCandidateFrame(nextFrame - 1, framesToSkip, playbackFrame);
+		while (nextFrame < candidate && skipFrame())
+		{
+		}
+	}
+
+	const int index = nextFrame;
+	cv::Mat frame;
+	if (!readFrame(frame))
+	{
+		LOG_CORE_DEBUG("Stream {} ended after {} frames", mediaSource, nextFrame);
+		return false;
+	}
+
+	const int msTimeStamp = (fps > 0) ? static_cast<int>(index * 1000.0 / fps) : 0;
+	return pushFrame(frame, index, msTimeStamp) && MemoryMedia::loadFrame();
+}
+
+void StreamMedia::setAnalysisWaitSeconds(int aws)
+{
+	if (fps <= 0)
+	{
+		if (aws > 0)
+		{
+			LOG_CORE_WARNING("Stream {} has no frame rate, every frame will be analysed", mediaSource);
+		}
+		return;
+	}
+
+	framesToSkip = static_cast<int>(fps * aws);
+	LOG_CORE_INFO("Skipping every {} seconds, every {} frames", aws, framesToSkip);
+}
+
+void StreamMedia::setPlaybackPosition(int msSinceStart)
+{
+	if (fps > 0)
+	{
+		playbackFrame = static_cast<int>(int64_t(msSinceStart) * fps / 1000);
+	}
+}
+
+}
@@ -23,8 +23,14 @@ public:
 
 	virtual std::string recognizeBox(TextBox& box);
 
+	virtual std::vector<std::string> recognizeBoxes(const std::vector<TextBox*>& boxes) override;
+
+	virtual void warmUp() override;
+
 protected:
 	cv::dnn::TextRecognitionModel textRecognition;
+	std::shared_ptr<cv::dnn::Net> network; //shared with other recognizers on the same inference context
+	cv::Size inputSize;
 
 };
 
@@ -0,0 +1,71 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "TextPrefilter.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+
+namespace tik
+{
+
+TextPrefilter::TextPrefilter(const PerformanceParams& params) :
+	threshold(params.prefilterThreshold), workingWidth(params.prefilterWidth), grid(params.prefilterGrid[0], params.prefilterGrid[1])
+{
+}
+
+std::vector<float> TextPrefilter::scoreTiles(const cv::Mat& frame)
+{
+	if (frame.channels() == 1)
+	{
+		gray = frame;
+	}
+	else
+	{
+		cv::cvtColor(frame, gray, (frame.channels() == 4) ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+	}
+
+	//Text strokes survive area downsampling, fine texture noise mostly doesn't
+	int width = std::min(workingWidth, gray.cols);
+	int height = std::max(1, gray.rows * width / gray.cols);
+	cv::resize(gray, small, cv::Size(width, height), 0, 0, cv::INTER_AREA);
+	cv::GaussianBlur(small, small, cv::Size(3, 3), 0);
+	cv::Canny(small, edges, 50, 150);
+
+	std::vector<float> scores;
+	scores.reserve(static_cast<size_t>(grid.width) * grid.height);
+	for (int row = 0; row < grid.height; row++)
+	{
+		for (int col = 0; col < grid.width; col++)
+		{
+			cv::Rect tile(col * edges.cols / grid.width, row * edges.rows / grid.height, 0, 0);
+			tile.width = (col + 1) * edges.cols / grid.width - tile.x;
+			tile.height = (row + 1) * edges.rows / grid.height - tile.y;
+
+			scores.push_back(tile.area() == 0 ? 0.0f : float(cv::countNonZero(edges(tile))) / tile.area());
+		}
+	}
+
+	return scores;
+}
+
+bool TextPrefilter::hasText(const cv::Mat& frame)
+{
+	std::vector<float> scores = scoreTiles(frame);
+	size_t textTiles = std::count_if(scores.begin(), scores.end(), [this](float score) { return score >= threshold; });
+
+	stats.framesEvaluated++;
+	stats.tilesEvaluated += scores.size();
+	stats.tilesBelowThreshold += scores.size() - textTiles;
+
+	if (textTiles == 0)
+	{
+		stats.framesSkipped++;
+		LOG_CORE_DEBUG("Prefilter found no text-like tiles, skipping detection");
+		return false;
+	}
+
+	return true;
+}
+
+}
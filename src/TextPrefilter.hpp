@@ -0,0 +1,43 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <opencv2/core.hpp>
+#include "fonttik/Metrics.hpp"
+
+namespace tik
+{
+
+struct PerformanceParams;
+
+/// <summary>
+/// Cheap classical check run before the detection network. The frame's luminance is downsampled and split in tiles,
+/// the text likelihood of each tile is its edge density. Frames where no tile reaches the threshold skip detection.
+/// </summary>
+class TextPrefilter
+{
+public:
+	TextPrefilter(const PerformanceParams& params);
+
+	/// <summary>
+	/// Returns true if any tile of the frame is likely to contain text, updates the counters
+	/// </summary>
+	bool hasText(const cv::Mat& frame);
+
+	/// <summary>
+	/// Edge density of each tile of the frame, row major
+	/// </summary>
+	std::vector<float> scoreTiles(const cv::Mat& frame);
+
+	PrefilterStats getStats() const { return stats; }
+
+private:
+	float threshold;
+	int workingWidth; //frames are downsampled to this width before scoring
+	cv::Size grid; //tile columns and rows
+
+	cv::Mat gray, small, edges; //reused between frames
+
+	PrefilterStats stats;
+};
+
+}
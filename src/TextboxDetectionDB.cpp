@@ -2,7 +2,9 @@
 #include "TextboxDetectionDB.h"
 #include "fonttik/ConfigurationParams.hpp"
 #include "fonttik/Log.h"
+#include "ModelRegistry.hpp"
 #include <random>
+#include <cmath>
 
 
 namespace tik {
@@ -10,12 +12,31 @@ namespace tik {
 	{
 		//Store sRGB Look up table
 		this->sRGB_LUT = sRGB_LUT;
+	}
+
+	TextboxDetectionDB::~TextboxDetectionDB() {
+	}
+
+	cv::Size TextboxDetectionDB::computeInputSize(const cv::Size& frameSize, int maxPixels, int stride)
+	{
+		//Scale both sides by the same factor so the frame area matches the budget, then round down to the stride
+		double scale = std::sqrt(double(maxPixels) / (double(frameSize.width) * frameSize.height));
+		//The epsilon keeps exact fits from being rounded down a whole stride by floating point error
+		int width = std::max(stride, int(frameSize.width * scale + 1e-6) / stride * stride);
+		int height = std::max(stride, int(frameSize.height * scale + 1e-6) / stride * stride);
 
+		return cv::Size(width, height);
+	}
+
+	void TextboxDetectionDB::createNetwork()
+	{
 		//Models can be found in https://github.com/opencv/opencv/blob/master/doc/tutorials/dnn/dnn_text_spotting/dnn_text_spotting.markdown
-		db = new cv::dnn::TextDetectionModel_DB(detectionParams->dbParams.detectionModel);
+		//A single network per detector, every input size shares its weights
+		network = ModelRegistry::getInstance().getNet(detectionParams->dbParams.detectionModel);
+		model = std::make_unique<cv::dnn::TextDetectionModel_DB>(*network);
 
 		// Post-processing parameters
-		db->setBinaryThreshold(detectionParams->dbParams.binThresh)
+		model->setBinaryThreshold(detectionParams->dbParams.binThresh)
 			.setPolygonThreshold(detectionParams->dbParams.polyThresh)
 			.setMaxCandidates(detectionParams->dbParams.maxCandidates)
 			.setUnclipRatio(detectionParams->dbParams.unclipRatio)
@@ -28,29 +49,55 @@ namespace tik {
 		auto mean = detectionParams->dbParams.mean;
 		cv::Scalar detMean(mean[0], mean[1], mean[2]);
 
-		// The input shape
-		auto size = detectionParams->dbParams.inputSize;
-		cv::Size inputSize = cv::Size(size[0], size[1]);
+		model->setInputParams(scale, cv::Size(), detMean);
 
-		db->setInputParams(scale, inputSize, detMean);
-
-		db->setPreferableBackend((cv::dnn::Backend)detectionParams->preferredBackend);
-		db->setPreferableTarget((cv::dnn::Target)detectionParams->preferredTarget);
+		model->setPreferableBackend((cv::dnn::Backend)detectionParams->preferredBackend);
+		model->setPreferableTarget((cv::dnn::Target)detectionParams->preferredTarget);
 	}
 
-	TextboxDetectionDB::~TextboxDetectionDB() {
-		if (db != nullptr) {
-			delete db;
+	std::vector<TextBox> TextboxDetectionDB::detectBoxes(const cv::Mat& img) {
+
+		// The input shape, the model maps the detections back to the frame size
+		// img can be a region of the frame, it gets the share of the input the region has of the frame
+		const DBDetectionParams& dbParams = detectionParams->dbParams;
+		cv::Size frameSize;
+		cv::Point offset;
+		img.locateROI(frameSize, offset);
+		const double frameShare = double(img.cols) * img.rows / (double(frameSize.width) * frameSize.height);
+
+		cv::Size inputSize;
+		if (dbParams.preserveAspectRatio)
+		{
+			inputSize = computeInputSize(img.size(), std::max(1, int(dbParams.maxInputPixels * frameShare)), dbParams.inputStride);
+		}
+		else
+		{
+			const int stride = dbParams.inputStride;
+			inputSize = cv::Size(std::max(stride, dbParams.inputSize[0] * img.cols / frameSize.width / stride * stride),
+				std::max(stride, dbParams.inputSize[1] * img.rows / frameSize.height / stride * stride));
 		}
-		db = nullptr;
-	} 
 
-	std::vector<TextBox> TextboxDetectionDB::detectBoxes(const cv::Mat& img) {
+		//Coarser input for real-time mode, still a multiple of the stride
+		if (inputScale != 1.0)
+		{
+			const int stride = dbParams.inputStride;
+			inputSize = cv::Size(std::max(stride, int(inputSize.width * inputScale) / stride * stride),
+				std::max(stride, int(inputSize.height * inputScale) / stride * stride));
+		}
 
 		std::vector< std::vector<cv::Point> > detResults;
+		if (network == nullptr)
+		{
+			createNetwork();
+		}
+
+		//The network is only reshaped when the input size changes
+		if (inputSize != modelInputSize)
 		{
-			db->detect(img, detResults);
+			model->setInputSize(inputSize);
+			modelInputSize = inputSize;
 		}
+		model->detect(img, detResults);
 
 		for (int i = 0; i < detResults.size(); i++) 
 		{
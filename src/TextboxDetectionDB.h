@@ -1,6 +1,8 @@
 // Copyright (C) 2022-2025 Electronic Arts, Inc.  All rights reserved.
 #pragma once
 #include "ITextboxDetection.h"
+#include <opencv2/dnn.hpp>
+#include <memory>
 
 namespace tik {
 class TextDetectionParams;
@@ -19,9 +21,16 @@ public:
 	virtual std::vector<TextBox> detectBoxes(const cv::Mat& img);
 	virtual LinesAndWords detectLinesAndWords(const cv::Mat& img);
 
+	//Largest input size under maxPixels that keeps the aspect ratio of frameSize, with both sides multiples of stride
+	static cv::Size computeInputSize(const cv::Size& frameSize, int maxPixels, int stride);
+
 private:
+	//Loads the network the first time it's needed, on the thread that runs the inference
+	void createNetwork();
 
-	cv::dnn::TextDetectionModel_DB* db;
+	std::shared_ptr<cv::dnn::Net> network; //shared with other detectors on the same inference context
+	std::unique_ptr<cv::dnn::TextDetectionModel_DB> model; //wraps network, preprocesses the frames itself
+	cv::Size modelInputSize; //input size model is set to
 };
 
 }
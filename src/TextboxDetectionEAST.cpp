@@ -7,102 +7,249 @@
 #include <iostream>
 #include "fonttik/Log.h"
 #include "fonttik/ConfigurationParams.hpp"
+#include "ModelRegistry.hpp"
+#include "EASTDecoder.hpp"
 
 #include <random>
 
 
 namespace tik {
+	const std::vector<std::string> TextboxDetectionEAST::EAST_OUTPUT_LAYERS = { "feature_fusion/Conv_7/Sigmoid", "feature_fusion/concat_3" };
+
 	void TextboxDetectionEAST::init(const std::vector<double>& sRGB_LUT)
 	{
 		//Store sRGB Look up table
 		this->sRGB_LUT = sRGB_LUT;
 
-		east = new cv::dnn::TextDetectionModel_EAST(detectionParams->eastParams.detectionModel);
-
 		LOG_CORE_TRACE("Confidence set to {0}", detectionParams->confidenceThreshold);
+		shapedInputs.setCapacity(detectionParams->inputCacheSize);
+	}
+
+	TextboxDetectionEAST::~TextboxDetectionEAST() {
+		shapedInputs.clear();
+	}
+
+	TextboxDetectionEAST::ShapedInput& TextboxDetectionEAST::getShapedInput(const cv::Size& inputSize)
+	{
+		ShapedInput* shaped = shapedInputs.get(inputSize);
+		if (shaped != nullptr)
+		{
+			return *shaped;
+		}
+
+		LOG_CORE_DEBUG("Allocating EAST buffers for a {}x{} input", inputSize.width, inputSize.height);
+		return shapedInputs.put(inputSize, { cv::Mat(inputSize, CV_8UC3) });
+	}
+
+	void TextboxDetectionEAST::createNetwork()
+	{
+		//A single network per detector, every input size shares its weights
+		network = ModelRegistry::getInstance().getNet(detectionParams->eastParams.detectionModel);
+		model = std::make_unique<cv::dnn::TextDetectionModel_EAST>(*network);
+
 		//Confidence on textbox threshold
-		east->setConfidenceThreshold(detectionParams->confidenceThreshold);
+		model->setConfidenceThreshold(detectionParams->confidenceThreshold);
 		//Non Maximum supression
-		east->setNMSThreshold(detectionParams->eastParams.nonMaxSuprresionThreshold);
+		model->setNMSThreshold(detectionParams->eastParams.nonMaxSuprresionThreshold);
 
-		east->setInputScale(detectionParams->eastParams.detectionScale);
+		model->setInputScale(detectionParams->eastParams.detectionScale);
 
 		//Default values from documentation are (123.68, 116.78, 103.94);
 		auto mean = detectionParams->eastParams.detectionMean;
 		cv::Scalar detMean(mean[0], mean[1], mean[2]);
-		east->setInputMean(detMean);
+		model->setInputMean(detMean);
 
-		east->setInputSwapRB(true);
+		model->setInputSwapRB(true);
 
-		east->setPreferableBackend((cv::dnn::Backend)detectionParams->preferredBackend);
-		east->setPreferableTarget((cv::dnn::Target)detectionParams->preferredTarget);
+		model->setPreferableBackend((cv::dnn::Backend)detectionParams->preferredBackend);
+		model->setPreferableTarget((cv::dnn::Target)detectionParams->preferredTarget);
 	}
 
-	TextboxDetectionEAST::~TextboxDetectionEAST() {
-		if (east != nullptr) {
-			delete east;
+	std::vector<std::vector<cv::Point>> TextboxDetectionEAST::runDetection(const cv::Mat& img, const cv::Size& inputSize, float confidenceThreshold)
+	{
+		if (network == nullptr)
+		{
+			createNetwork();
+		}
+
+		//Inputs whose size changes every call don't take over the cache
+		ShapedInput& shaped = variableInputSize ? variableInput : getShapedInput(inputSize);
+
+		if (detectionParams->eastParams.customDecode)
+		{
+			//The blob and the outputs are reused between calls with the same input size
+			return runRawDetection(*network, shaped.blob, shaped.outputs, img, inputSize, confidenceThreshold);
+		}
+
+		if (inputSize != modelInputSize)
+		{
+			model->setInputSize(inputSize);
+			modelInputSize = inputSize;
 		}
+
+		model->setConfidenceThreshold(confidenceThreshold);
+		cv::resize(img, shaped.input, inputSize);
+
+		std::vector< std::vector<cv::Point> > results;
+		model->detect(shaped.input, results);
+
+		//Transform points to original image size
+		const float widthRatio = float(inputSize.width) / img.cols;
+		const float heightRatio = float(inputSize.height) / img.rows;
+		for (auto& points : results)
+		{
+			for (auto& point : points)
+			{
+				point.x /= widthRatio;
+				point.y /= heightRatio;
+
+				//Make sure points are within bounds
+				point.x = std::min(std::max(0, point.x), img.cols);
+				point.y = std::min(std::max(0, point.y), img.rows);
+			}
+		}
+
+		return results;
 	}
 
-	void TextboxDetectionEAST::fourPointsTransform(const cv::Mat& frame, const cv::Point2f vertices[], cv::Mat& result)
+	std::vector<std::vector<cv::Point>> TextboxDetectionEAST::runRawDetection(cv::dnn::Net& network, cv::Mat& blob, std::vector<cv::Mat>& outputs,
+		const cv::Mat& img, const cv::Size& inputSize, float confidenceThreshold)
 	{
-		const cv::Size outputSize = cv::Size(100, 32);
+		auto mean = detectionParams->eastParams.detectionMean;
+		cv::dnn::blobFromImage(img, blob, detectionParams->eastParams.detectionScale, inputSize,
+			cv::Scalar(mean[0], mean[1], mean[2]), true, false);
+		network.setInput(blob);
+		network.forward(outputs, EAST_OUTPUT_LAYERS);
 
-		cv::Point2f targetVertices[4] = {
-			cv::Point(0, outputSize.height - 1),
-			cv::Point(0, 0), cv::Point(outputSize.width - 1, 0),
-			cv::Point(outputSize.width - 1, outputSize.height - 1)
-		};
-		cv::Mat rotationMatrix = getPerspectiveTransform(vertices, targetVertices);
+		return EASTDecoder::detect(outputs[0], outputs[1], confidenceThreshold,
+			detectionParams->eastParams.nonMaxSuprresionThreshold, inputSize, img.size());
+	}
 
-		warpPerspective(frame, result, rotationMatrix, outputSize);
+	cv::Size TextboxDetectionEAST::getAlignedInputSize(const cv::Size& size)
+	{
+		return cv::Size(32 * std::max(1, (size.width + 31) / 32), 32 * std::max(1, (size.height + 31) / 32));
 	}
 
-	std::vector<TextBox> TextboxDetectionEAST::detectBoxes(const cv::Mat& img)
+	std::vector<std::vector<cv::Point>> TextboxDetectionEAST::detectRefined(const cv::Mat& img, float confidenceThreshold)
 	{
-		//Calculate needed conversion for new width and height to be multiples of 32
-		////This needs to be multiple of 32
-		const int inpWidth = 32 * (img.cols / 32 + ((img.cols % 32 != 0) ? 1 : 0));
-		const int inpHeight = 32 * (img.rows / 32 + ((img.rows % 32 != 0) ? 1 : 0));
-		const float widthRatio = float(inpWidth) / img.cols;
-		const float heightRatio = float(inpHeight) / img.rows;
+		const EASTDetectionParams& eastParams = detectionParams->eastParams;
 
-		const cv::Size detInputSize = cv::Size(inpWidth, inpHeight);
+		//Candidate pass on a downscaled copy
+		const double scale = double(eastParams.refineDetectionHeight) / img.rows;
+		const cv::Size downscaledSize(std::max(1, cvRound(img.cols * scale)), eastParams.refineDetectionHeight);
+		cv::resize(img, downscaled, downscaledSize, 0, 0, cv::INTER_AREA);
 
-		east->setInputSize(detInputSize);
-		east->setConfidenceThreshold(detectionParams->confidenceThreshold);
+		std::vector< std::vector<cv::Point> > candidates = runDetection(downscaled, getAlignedInputSize(downscaledSize), confidenceThreshold);
 
-		//Image reading
-		cv::Mat resizedImg;
-		cv::resize(img, resizedImg, detInputSize);
+		//Candidate regions in frame coordinates, padded so the network sees the text's surroundings
+		const cv::Rect frameRect(0, 0, img.cols, img.rows);
+		std::vector<cv::Rect> regions;
+		for (const auto& candidate : candidates)
+		{
+			cv::Rect rect = cv::boundingRect(candidate);
+			cv::Rect region(cvFloor(rect.x / scale), cvFloor(rect.y / scale), cvCeil(rect.width / scale), cvCeil(rect.height / scale));
+			const int padding = eastParams.refinePadding + region.height;
+			region = cv::Rect(region.x - padding, region.y - padding, region.width + 2 * padding, region.height + 2 * padding) & frameRect;
+			if (!region.empty())
+			{
+				regions.push_back(region);
+			}
+		}
 
-		std::vector< std::vector<cv::Point> > detResults;
+		//Merge overlapping regions so no text is detected twice
+		for (bool merged = true; merged;)
 		{
-			east->detect(resizedImg, detResults);
+			merged = false;
+			for (size_t i = 0; i < regions.size() && !merged; i++)
+			{
+				for (size_t j = i + 1; j < regions.size(); j++)
+				{
+					if ((regions[i] & regions[j]).area() > 0)
+					{
+						regions[i] |= regions[j];
+						regions.erase(regions.begin() + j);
+						merged = true;
+						break;
+					}
+				}
+			}
 		}
 
-		LOG_CORE_TRACE("DB_EAST found {0} boxes", detResults.size());
+		size_t regionsArea = 0;
+		for (const cv::Rect& region : regions)
+		{
+			regionsArea += region.area();
+		}
 
-		//Transform points to original image size
+		//Refining most of the frame is slower than a single full resolution pass
+		if (regionsArea * 2 > size_t(frameRect.area()))
 		{
-			for (int i = 0; i < detResults.size(); i++) {
-				for (int j = 0; j < detResults[i].size(); j++) {
-					detResults[i][j].x /= widthRatio;
-					detResults[i][j].y /= heightRatio;
-
-					//Make sure points are within bounds
-					detResults[i][j].x = std::min(std::max(0, detResults[i][j].x), img.cols);
-					detResults[i][j].y = std::min(std::max(0, detResults[i][j].y), img.rows);
+			LOG_CORE_TRACE("Candidate regions cover most of the frame, detecting at full resolution");
+			return runDetection(img, getAlignedInputSize(img.size()), confidenceThreshold);
+		}
+
+		//Region sizes change every frame, they all share a single network
+		const bool previousVariableInputSize = variableInputSize;
+		variableInputSize = true;
+
+		std::vector< std::vector<cv::Point> > results;
+		for (const cv::Rect& region : regions)
+		{
+			for (auto& points : runDetection(img(region), getAlignedInputSize(region.size()), confidenceThreshold))
+			{
+				for (auto& point : points)
+				{
+					point += region.tl();
 				}
+				results.push_back(points);
 			}
 		}
 
+		variableInputSize = previousVariableInputSize;
+
+		LOG_CORE_TRACE("DB_EAST refined {0} candidates in {1} regions ({2:.1f}% of the frame)", candidates.size(), regions.size(),
+			100.0 * regionsArea / frameRect.area());
+
+		return results;
+	}
+
+	void TextboxDetectionEAST::fourPointsTransform(const cv::Mat& frame, const cv::Point2f vertices[], cv::Mat& result)
+	{
+		const cv::Size outputSize = cv::Size(100, 32);
+
+		cv::Point2f targetVertices[4] = {
+			cv::Point(0, outputSize.height - 1),
+			cv::Point(0, 0), cv::Point(outputSize.width - 1, 0),
+			cv::Point(outputSize.width - 1, outputSize.height - 1)
+		};
+		cv::Mat rotationMatrix = getPerspectiveTransform(vertices, targetVertices);
+
+		warpPerspective(frame, result, rotationMatrix, outputSize);
+	}
+
+	std::vector<TextBox> TextboxDetectionEAST::detectBoxes(const cv::Mat& img)
+	{
+		//Input width and height need to be multiples of 32. Coarse detections skip refining, they are meant to be cheap
+		const bool refine = detectionParams->eastParams.refineHighResolution && img.rows > detectionParams->eastParams.refineDetectionHeight &&
+			inputScale >= 1.0;
+		const cv::Size inputSize(std::max(1, cvRound(img.cols * inputScale)), std::max(1, cvRound(img.rows * inputScale)));
+		std::vector< std::vector<cv::Point> > detResults = refine ?
+			detectRefined(img, detectionParams->confidenceThreshold) :
+			runDetection(img, getAlignedInputSize(inputSize), detectionParams->confidenceThreshold);
+
+		LOG_CORE_TRACE("DB_EAST found {0} boxes", detResults.size());
+
 		// Remove big boxes as they will be detected separately
+		// Thresholds depend on the media resolution, img can be a cropped region of the frame
+		cv::Size frameSize;
+		cv::Point offset;
+		img.locateROI(frameSize, offset);
+
 		int minHeight = 40;
-		if (img.rows == 1080) {
+		if (frameSize.height == 1080) {
 			minHeight = 60;
 		}
-		else if (img.rows >= 2160) {
+		else if (frameSize.height >= 2160) {
 			minHeight = 120;
 		}
 
@@ -112,45 +259,31 @@ namespace tik {
 			}), detResults.end());		
 
 		// Big text detection
-		cv::Size bigTextInputSize = cv::Size(736, 384);
-		cv::resize(img, resizedImg, bigTextInputSize);
-		east->setInputSize(bigTextInputSize);
-		east->setConfidenceThreshold(0.75);
-
-		std::vector< std::vector<cv::Point> > bigTextResults;
-		{
-			east->detect(resizedImg, bigTextResults);
-		}
+		// Same scale as a 736x384 input over the whole frame
+		cv::Size bigTextInputSize = getAlignedInputSize(cv::Size(736 * img.cols / frameSize.width, 384 * img.rows / frameSize.height));
+		std::vector< std::vector<cv::Point> > bigTextResults = runDetection(img, bigTextInputSize, 0.75);
 
 		LOG_CORE_TRACE("DB_EAST found {0} big boxes", bigTextResults.size());
 
-		const float bigTextWidthRatio = float(bigTextInputSize.width) / img.cols;
-		const float bigTextHeightRatio = float(bigTextInputSize.height) / img.rows;
-		//Transform points to original image size
+		// Merge results
+		std::vector<cv::Rect> detRects;
+		detRects.reserve(detResults.size() + bigTextResults.size());
+		for (const auto& detResult : detResults)
 		{
-			for (int i = 0; i < bigTextResults.size(); i++) {
-				for (int j = 0; j < bigTextResults[i].size(); j++) {
-					bigTextResults[i][j].x /= bigTextWidthRatio;
-					bigTextResults[i][j].y /= bigTextHeightRatio;
-
-					//Make sure points are within bounds
-					bigTextResults[i][j].x = std::min(std::max(0, bigTextResults[i][j].x), img.cols);
-					bigTextResults[i][j].y = std::min(std::max(0, bigTextResults[i][j].y), img.rows);
-				}
-			}
+			detRects.push_back(cv::boundingRect(detResult));
 		}
 
-		// Merge results
 		for (const auto& bigText : bigTextResults)
 		{
+			cv::Rect bigTextRect = cv::boundingRect(bigText);
 			// Ignore big text boxes that are too small
-			if (cv::boundingRect(bigText).height < minHeight) {
+			if (bigTextRect.height < minHeight) {
 				continue;
 			}
 			bool found = false;
-			for (auto& detResult : detResults)
+			for (size_t i = 0; i < detResults.size(); i++)
 			{
-				if (detResult.size() == 4 && cv::boundingRect(detResult).contains(cv::Point(bigText[0].x, bigText[0].y)))
+				if (detResults[i].size() == 4 && detRects[i].contains(cv::Point(bigText[0].x, bigText[0].y)))
 				{
 					found = true;
 					break;
@@ -159,6 +292,7 @@ namespace tik {
 			if (!found)
 			{
 				detResults.push_back(bigText);
+				detRects.push_back(bigTextRect);
 			}
 		}
 
@@ -183,15 +317,19 @@ namespace tik {
 	{
 		auto boxes = detectBoxes(img);
 
-		//merge lines
+		//merge lines, thresholds depend on the media resolution, img can be a cropped region of the frame
+		cv::Size frameSize;
+		cv::Point offset;
+		img.locateROI(frameSize, offset);
+
 		double MAX_Y_DIFF = 10.0;
-		if (img.rows == 720) {
+		if (frameSize.height == 720) {
 			MAX_Y_DIFF = 5;
 		}
-		if (img.rows == 1080) {
+		if (frameSize.height == 1080) {
 			MAX_Y_DIFF = 10;
 		}
-		if (img.rows >= 2160) {
+		if (frameSize.height >= 2160) {
 			MAX_Y_DIFF = 20;
 		}
 		const int TEXT_BOX_BUFFER = 4;
@@ -2,6 +2,9 @@
 
 #pragma once
 #include "ITextboxDetection.h"
+#include "LRUCache.hpp"
+#include <opencv2/dnn.hpp>
+#include <memory>
 
 namespace tik {
 	
@@ -21,8 +24,50 @@ public:
 	virtual std::vector<TextBox> detectBoxes(const cv::Mat& img);
 	virtual LinesAndWords detectLinesAndWords(const cv::Mat& img);
 
+	virtual CacheStats getInputCacheStats() const override { return shapedInputs.getStats(); }
+
 protected:
-	cv::dnn::TextDetectionModel_EAST* east;
+	//Buffers for one input size, the network is reshaped when the size changes but the buffers are reused
+	struct ShapedInput
+	{
+		cv::Mat input; //resized frame
+		cv::Mat blob; //network input for the custom decode path
+		std::vector<cv::Mat> outputs; //score and geometry maps for the custom decode path
+	};
+
+	struct SizeHash
+	{
+		size_t operator()(const cv::Size& size) const { return std::hash<long long>()((static_cast<long long>(size.width) << 32) | size.height); }
+	};
+
+	//Returns the buffers for the given input size, creating them if they aren't cached
+	ShapedInput& getShapedInput(const cv::Size& inputSize);
+
+	//Loads the network the first time it's needed, on the thread that runs the inference
+	void createNetwork();
+
+	//Runs the network over img resized to inputSize, returns the detected quads in img coordinates
+	std::vector<std::vector<cv::Point>> runDetection(const cv::Mat& img, const cv::Size& inputSize, float confidenceThreshold);
+
+	//Forwards img through a raw network and decodes the outputs, blob and outputs are reused buffers
+	std::vector<std::vector<cv::Point>> runRawDetection(cv::dnn::Net& network, cv::Mat& blob, std::vector<cv::Mat>& outputs,
+		const cv::Mat& img, const cv::Size& inputSize, float confidenceThreshold);
+
+	//Finds candidates on a downscaled copy of img and detects again at native resolution around them
+	std::vector<std::vector<cv::Point>> detectRefined(const cv::Mat& img, float confidenceThreshold);
+
+	//Smallest input size with both sides non-zero multiples of 32 that fits the given size
+	static cv::Size getAlignedInputSize(const cv::Size& size);
+
+	static const std::vector<std::string> EAST_OUTPUT_LAYERS; //score and geometry layers
+
+	std::shared_ptr<cv::dnn::Net> network; //shared with other detectors on the same inference context
+	std::unique_ptr<cv::dnn::TextDetectionModel_EAST> model; //wraps network
+	cv::Size modelInputSize; //input size model is set to
+
+	LRUCache<cv::Size, ShapedInput, SizeHash> shapedInputs;
+	ShapedInput variableInput; //used while variableInputSize is set
+	cv::Mat downscaled; //frame copy for the refine candidate pass
 
 	static void fourPointsTransform(const cv::Mat& frame, const cv::Point2f vertices[], cv::Mat& result);
 };
@@ -2,6 +2,7 @@
 
 #include "TextBoxRecognitionOpenCV.hpp"
 #include "fonttik/TextBox.hpp"
+#include "ModelRegistry.hpp"
 #include <fstream>
 
 
@@ -10,7 +11,8 @@ namespace tik
 
 void TextBoxRecognitionOpenCV::init(const TextRecognitionParams& params) 
 {
-	textRecognition = cv::dnn::TextRecognitionModel(params.recognitionModel);
+	network = ModelRegistry::getInstance().getNet(params.recognitionModel);
+	textRecognition = cv::dnn::TextRecognitionModel(*network);
 	textRecognition.setDecodeType(params.decodeType);
 
 	std::ifstream vocFile;
@@ -30,7 +32,8 @@ void TextBoxRecognitionOpenCV::init(const TextRecognitionParams& params)
 	auto mean = params.mean;
 	// The input shape
 	std::pair<int, int> size = params.size;
-	textRecognition.setInputParams(params.scale, cv::Size(size.first, size.second), cv::Scalar(mean[0], mean[1], mean[2]));
+	inputSize = cv::Size(size.first, size.second);
+	textRecognition.setInputParams(params.scale, inputSize, cv::Scalar(mean[0], mean[1], mean[2]));
 
 	textRecognition.setPreferableBackend(cv::dnn::DNN_BACKEND_DEFAULT);
 	textRecognition.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
@@ -41,4 +44,45 @@ std::string TextBoxRecognitionOpenCV::recognizeBox(TextBox& box)
 	return textRecognition.recognize(box.getSubMatrix());
 }
 
+std::vector<std::string> TextBoxRecognitionOpenCV::recognizeBoxes(const std::vector<TextBox*>& boxes)
+{
+	if (boxes.size() < 2)
+	{
+		return ITextBoxRecognition::recognizeBoxes(boxes);
+	}
+
+	//Box submatrices are regions of the frame, recover it so every box is recognized in a single call over its regions
+	cv::Mat frame = boxes[0]->getSubMatrix();
+	std::vector<cv::Rect> regions;
+	regions.reserve(boxes.size());
+	for (TextBox* box : boxes)
+	{
+		const cv::Mat subMatrix = box->getSubMatrix();
+		if (subMatrix.datastart != frame.datastart)
+		{
+			return ITextBoxRecognition::recognizeBoxes(boxes);
+		}
+
+		cv::Size wholeSize;
+		cv::Point offset;
+		subMatrix.locateROI(wholeSize, offset);
+		regions.push_back(cv::Rect(offset, subMatrix.size()));
+	}
+
+	cv::Size wholeSize;
+	cv::Point offset;
+	frame.locateROI(wholeSize, offset);
+	frame.adjustROI(offset.y, wholeSize.height - offset.y - frame.rows, offset.x, wholeSize.width - offset.x - frame.cols);
+
+	std::vector<std::string> texts;
+	textRecognition.recognize(frame, regions, texts);
+	return texts;
+}
+
+void TextBoxRecognitionOpenCV::warmUp()
+{
+	cv::Mat blank = cv::Mat::zeros(inputSize, CV_8UC3);
+	textRecognition.recognize(blank);
+}
+
 }
\ No newline at end of file
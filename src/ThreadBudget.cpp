@@ -0,0 +1,155 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include "ThreadBudget.hpp"
+#include "fonttik/Log.h"
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace tik
+{
+
+//Cores the process may run on, which containers and taskset can restrict to fewer than the machine has
+static std::vector<unsigned> allowedCores()
+{
+	std::vector<unsigned> cores;
+#ifdef _WIN32
+	DWORD_PTR processMask = 0, systemMask = 0;
+	if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+	{
+		for (unsigned core = 0; core < sizeof(DWORD_PTR) * 8; core++)
+		{
+			if (processMask & (DWORD_PTR(1) << core))
+			{
+				cores.push_back(core);
+			}
+		}
+	}
+#elif defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	if (sched_getaffinity(0, sizeof(set), &set) == 0)
+	{
+		for (unsigned core = 0; core < CPU_SETSIZE; core++)
+		{
+			if (CPU_ISSET(core, &set))
+			{
+				cores.push_back(core);
+			}
+		}
+	}
+#endif
+
+	if (cores.empty())
+	{
+		for (unsigned core = 0; core < std::max(1u, std::thread::hardware_concurrency()); core++)
+		{
+			cores.push_back(core);
+		}
+	}
+	return cores;
+}
+
+ThreadBudget& ThreadBudget::getInstance()
+{
+	static ThreadBudget instance;
+	return instance;
+}
+
+ThreadBudget::ThreadBudget() : cores(allowedCores()), threads(static_cast<int>(cores.size()))
+{
+}
+
+void ThreadBudget::configure(int budget, bool pin)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	int total = (budget > 0) ? budget : static_cast<int>(cores.size());
+	if (configured && total == threads && pin == pinThreads)
+	{
+		return;
+	}
+
+	threads = total;
+	pinThreads = pin;
+	configured = true;
+	LOG_CORE_DEBUG("Thread budget set to {0} threads{1}", threads, pinThreads ? ", pinned to cores" : "");
+	rebalance();
+}
+
+ThreadBudget::Lease ThreadBudget::acquire(int requested)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	int extra = std::max(0, std::min(requested - 1, threads - leased));
+	if (extra > 0)
+	{
+		leased += extra;
+		rebalance();
+	}
+	return Lease(this, extra);
+}
+
+int ThreadBudget::getThreads() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return threads;
+}
+
+void ThreadBudget::release(int extra)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	leased -= extra;
+	rebalance();
+}
+
+void ThreadBudget::rebalance()
+{
+	//OpenCV's pool is process wide, every thread in use gets an equal share of the budget for its OpenCV and DNN work
+	cv::setNumThreads(std::max(1, threads / leased));
+}
+
+void ThreadBudget::pinCurrentThread()
+{
+	{
+		//Every Fonttik::init configures the budget, possibly while other threads are being pinned
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!pinThreads)
+		{
+			return;
+		}
+	}
+
+	const unsigned core = cores[nextCore++ % cores.size()];
+#ifdef _WIN32
+	if (SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) == 0)
+	{
+		LOG_CORE_WARNING("Unable to pin thread to core {0}", core);
+	}
+#elif defined(__linux__)
+	cpu_set_t cores;
+	CPU_ZERO(&cores);
+	CPU_SET(core, &cores);
+	if (pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores) != 0)
+	{
+		LOG_CORE_WARNING("Unable to pin thread to core {0}", core);
+	}
+#endif
+}
+
+ThreadBudget::Lease::~Lease()
+{
+	if (extra > 0)
+	{
+		budget->release(extra);
+	}
+}
+
+}
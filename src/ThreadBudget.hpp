@@ -0,0 +1,88 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace tik
+{
+
+/// <summary>
+/// Process wide number of threads Fonttik may keep busy. Fonttik's own pools (batch workers, video segments, duplicate hashing) lease
+/// their threads from it, and OpenCV's thread pool, which also runs DNN inference, gets the budget divided by the threads leased,
+/// so running more jobs at once gives each of them fewer OpenCV threads instead of oversubscribing the cores.
+/// Only threads leased from the budget are counted: the threads of the embedding application, the writer threads of asynchronous
+/// analysis and the threads that write outlines run on top of it, leave room for them when setting the budget.
+/// </summary>
+class ThreadBudget
+{
+public:
+	static ThreadBudget& getInstance();
+
+	/// <summary>
+	/// Standalone budget, e.g. for tests. Fonttik's pools all use getInstance, OpenCV's thread count is still set process wide.
+	/// </summary>
+	ThreadBudget();
+
+	ThreadBudget(const ThreadBudget&) = delete;
+	ThreadBudget& operator=(const ThreadBudget&) = delete;
+
+	/// <summary>
+	/// Threads leased from the budget, returned when the lease is destroyed. Always holds at least the calling thread.
+	/// </summary>
+	class Lease
+	{
+	public:
+		Lease(Lease&& other) noexcept : budget(other.budget), extra(other.extra) { other.extra = 0; }
+		Lease(const Lease&) = delete;
+		Lease& operator=(const Lease&) = delete;
+		~Lease();
+
+		//Threads the pool can run, the calling thread included
+		int size() const { return 1 + extra; }
+
+	private:
+		friend class ThreadBudget;
+		Lease(ThreadBudget* budget, int extra) : budget(budget), extra(extra) {}
+
+		ThreadBudget* budget;
+		int extra; //threads granted on top of the calling thread
+	};
+
+	/// <summary>
+	/// Sets the budget and the pinning policy
+	/// </summary>
+	/// <param name="threads">Total threads, 0 uses one per core the process may run on</param>
+	/// <param name="pinThreads">Pin pool threads to cores, consecutive threads get consecutive cores of the process affinity mask</param>
+	void configure(int threads, bool pinThreads);
+
+	int getThreads() const;
+
+	/// <summary>
+	/// Leases up to requested threads for a pool. Fewer are granted when other pools hold part of the budget, a single thread
+	/// means the pool should run on the calling thread.
+	/// </summary>
+	Lease acquire(int requested);
+
+	/// <summary>
+	/// Pins the calling thread to the next core the process may run on if pinning is enabled. Only supported on Linux and Windows.
+	/// </summary>
+	void pinCurrentThread();
+
+private:
+	void release(int extra);
+
+	//Divides the budget between the threads in use, called with the mutex held
+	void rebalance();
+
+	mutable std::mutex mutex;
+	const std::vector<unsigned> cores; //process affinity mask when the budget was created, before any thread is pinned
+	int threads;
+	int leased = 1; //threads in use, starting with the thread that uses Fonttik
+	bool pinThreads = false;
+	bool configured = false; //OpenCV's thread count is only set once the budget is configured
+	std::atomic<unsigned> nextCore{ 0 };
+};
+
+}
@@ -8,9 +8,6 @@
 namespace tik
 {
 
-int Video::framesToSkip = 0;
-int Video::fps = 0;
-
 Video::Video(std::string mediaSource) : Media(mediaSource), msTimeStamp{ 0 }
 {
 	video.open(mediaSource);
@@ -53,16 +50,23 @@ bool Video::loadFrame()
 	if (!currentFrame.empty())
 	{
 		previousFrame = currentFrame.clone();
+		const int candidate = nextCandidateFrame(frameIndex, framesToSkip, playbackFrame);
+
+		//Real-time mode drops the frames that played while the previous one was being analysed, they don't need decoding
+		while (frameIndex + 1 < playbackFrame && frameIndex + 1 < endFrame && video.grab())
+		{
+			frameIndex++;
+		}
 
-		for (int i = 1; i < framesToSkip && !currentFrame.empty(); i++)
+		do
 		{
 			//Skip the amount of frames specified by configuration
 			video >> currentFrame;
 			frameIndex++;
-		}
+		} while (frameIndex < candidate && !currentFrame.empty() && frameIndex < endFrame);
 
-		while ((!currentFrame.empty() && compareFramesSimilarity(previousFrame, currentFrame))
-			|| (currentFrame.empty() && !finishedVideo(video))) 
+		while (((!currentFrame.empty() && compareFramesSimilarity(previousFrame, currentFrame))
+			|| (currentFrame.empty() && !finishedVideo(video))) && frameIndex < endFrame)
 		{
 			//Keep loading new frames until video is over or we find one that is 
 			//sufficiently different from the previously processed one
@@ -70,6 +74,11 @@ bool Video::loadFrame()
 			frameIndex++;
 		}
 
+		if (frameIndex >= endFrame)
+		{
+			return false;
+		}
+
 		LOG_CORE_INFO("Processing video frame {0} - {1:.3}%", frameIndex, std::min(getLength(video) * 100, 100.0));
 
 		msTimeStamp = 1000.0 * (double)frameIndex / fps;
@@ -78,16 +87,21 @@ bool Video::loadFrame()
 	else
 	{
 		frameIndex++;
+		firstFrame = frameIndex;
 		return video.read(currentFrame);
 	}
 }
 
 Frame Video::getFrame()
 {
-	return Frame(currentFrame.clone(), mask, frameIndex, msTimeStamp);
+	updateContentRect(currentFrame);
+
+	Frame frame(currentFrame.clone(), mask, frameIndex, msTimeStamp);
+	frame.setContentRect(contentRect);
+	return frame;
 }
 
-void storeResultsInFrame(cv::Mat frameCopy, const std::vector<ResultBox>& res, Media::SaveResultProperties props, bool decimals, cv::VideoWriter out, cv::Size size) 
+void Video::storeResultsInFrame(cv::Mat frameCopy, const std::vector<ResultBox>& res, Media::SaveResultProperties props, bool decimals, cv::VideoWriter out, cv::Size size) 
 {
 	//Write boxes
 	for (const ResultBox& box : res) 
@@ -226,8 +240,8 @@ void Video::saveResultsOutlinesAsync(const SaveResultProperties& sizeResultPrope
 
 					std::thread t1(storeResultsInFrame, frameMat.clone(), std::ref(previous.value().size.results), std::ref(sizeResultProperties), false, OutVideoSize, size);
 					std::thread t2(storeResultsInFrame, frameMat.clone(), std::ref(previous.value().contrast.results), std::ref(contrastResultProperties), true, OutVideoContrast, size);
-					storeResultsInJSON(previous.value().size.results, frameIndex, previous.value().timeStamp, outSizeJson);
-					storeResultsInJSON(previous.value().contrast.results, frameIndex, previous.value().timeStamp, outContrastJson);
+					storeResultsInJSON(previous.value().size, frameIndex, previous.value().timeStamp, outSizeJson);
+					storeResultsInJSON(previous.value().contrast, frameIndex, previous.value().timeStamp, outContrastJson);
 
 					//get next frame
 					frameIndex++;
@@ -270,8 +284,8 @@ void Video::saveResultsOutlinesAsync(const SaveResultProperties& sizeResultPrope
 
 			std::thread t1(storeResultsInFrame, frameMat.clone(), std::ref(previous.value().size.results), std::ref(sizeResultProperties), false, OutVideoSize, size);
 			std::thread t2(storeResultsInFrame, frameMat.clone(), std::ref(previous.value().contrast.results), std::ref(contrastResultProperties), true, OutVideoContrast, size);
-			storeResultsInJSON(previous.value().size.results, frameIndex, previous.value().timeStamp, outSizeJson);
-			storeResultsInJSON(previous.value().contrast.results, frameIndex, previous.value().timeStamp, outContrastJson);
+			storeResultsInJSON(previous.value().size, frameIndex, previous.value().timeStamp, outSizeJson);
+			storeResultsInJSON(previous.value().contrast, frameIndex, previous.value().timeStamp, outContrastJson);
 
 			frameIndex++;
 			inputVideo >> frameMat;
@@ -291,15 +305,19 @@ void Video::saveResultsOutlinesAsync(const SaveResultProperties& sizeResultPrope
 }
 
 
-void Video::storeResultsInJSON(const std::vector<ResultBox>& res, int id, const std::string& timeStamp, std::ofstream& out)
+void Video::storeResultsInJSON(const FrameResults& results, int id, const std::string& timeStamp, std::ofstream& out, bool contrast)
 {
 	using json = nlohmann::json;
 	json jFrame = json();
 	jFrame["id"] = id;
 	jFrame["timeStamp"] = timeStamp;
+	if (results.degradedStages != DEGRADED_NONE)
+	{
+		jFrame["degraded"] = tik::DegradedStagesAsStrings(results.degradedStages);
+	}
 	jFrame["results"] = json::array();
 
-	for (auto res : res)
+	for (auto res : results.results)
 	{
 		json jResult = json();
 		jResult["type"] = tik::ResultTypeAsString(res.type);
@@ -309,6 +327,22 @@ void Video::storeResultsInJSON(const std::vector<ResultBox>& res, int id, const
 		jResult["height"] = res.height;
 		jResult["value"] = res.value;
 		jResult["text"] = res.text;
+		if (res.trackId >= 0)
+		{
+			jResult["trackId"] = res.trackId;
+		}
+
+		if (contrast && !res.colorblindValues.empty())
+		{
+			jResult["protanValue"] = res.colorblindValues[0];
+			jResult["protanType"] = tik::ResultTypeAsString(res.colorblindTypes[0]);
+			jResult["deutanValue"] = res.colorblindValues[1];
+			jResult["deutanType"] = tik::ResultTypeAsString(res.colorblindTypes[1]);
+			jResult["tritanValue"] = res.colorblindValues[2];
+			jResult["tritanType"] = tik::ResultTypeAsString(res.colorblindTypes[2]);
+			jResult["grayscaleValue"] = res.colorblindValues[3];
+			jResult["grayscaleType"] = tik::ResultTypeAsString(res.colorblindTypes[3]);
+		}
 
 		jFrame["results"].push_back(jResult);
 	}
@@ -352,6 +386,30 @@ bool Video::compareFramesSimilarity(const cv::Mat& mat1, const cv::Mat& mat2)
 	return true;
 }
 
+int Video::nextCandidateFrame(int lastAnalysed, int framesToSkip, int playbackFrame)
+{
+	//The frame after the skip interval ends is analysed, and never the last analysed frame again
+	return std::max(lastAnalysed, playbackFrame - 1) + std::max(framesToSkip - 1, 1);
+}
+
+void Video::setFrameRange(int first, int end)
+{
+	//Seeks are frame accurate, the decoder starts at the previous keyframe and decodes up to the requested frame
+	video.set(cv::CAP_PROP_POS_FRAMES, first);
+	frameIndex = first - 1;
+	endFrame = end;
+	currentFrame.release();
+	previousFrame.release();
+}
+
+void Video::setPlaybackPosition(int msSinceStart)
+{
+	if (firstFrame >= 0)
+	{
+		playbackFrame = firstFrame + int(int64_t(msSinceStart) * fps / 1000);
+	}
+}
+
 void Video::setAnalysisWaitSeconds(int aws)
 {
 	framesToSkip = fps * aws;
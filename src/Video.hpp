@@ -3,6 +3,7 @@
 #pragma once
 #include "fonttik/Media.hpp"
 #include <atomic>
+#include <climits>
 
 namespace tik
 {
@@ -29,31 +30,61 @@ public:
 
 	//Sets how many frames should video processing skip between each frame analyzed by X amount of seconds
 	virtual void setAnalysisWaitSeconds(int aws) override;
+
+	virtual void setPlaybackPosition(int msSinceStart) override;
 	
 
 	/// <summary>
-	/// Compares the given image matrix to the video's previousFrame.
+	/// Compares two frames, frames similar to the last analysed one are skipped. Also used by image sequences.
 	/// </summary>
-	/// <param name="mat">Matrix to be compared two</param>
 	/// <returns>True in case they are similar, false otherwise</returns>
-	bool compareFramesSimilarity(const cv::Mat& a, const cv::Mat& b);
+	static bool compareFramesSimilarity(const cv::Mat& a, const cv::Mat& b);
+
+	/// <summary>
+	/// First frame that can be analysed after lastAnalysed, frames before it are skipped by AnalysisWaitSeconds or dropped by real-time
+	/// mode. Later frames are only analysed if this one is similar to lastAnalysed. Also used by image sequences.
+	/// </summary>
+	static int nextCandidateFrame(int lastAnalysed, int framesToSkip, int playbackFrame);
+
+	/// <summary>
+	/// Restricts analysis to the frames in [first, end), used to analyse segments of a video concurrently.
+	/// The first frame is always analysed, as the first frame of a whole video is.
+	/// </summary>
+	void setFrameRange(int first, int end);
+
+	//Index of the first frame loadFrame will load, only valid before analysis starts
+	int getStartFrame() const { return frameIndex + 1; }
+
+	int getFrameCount() const { return (int)video.get(cv::CAP_PROP_FRAME_COUNT); }
+
+	int getFramesToSkip() const { return framesToSkip; }
+	int getFps() const { return fps; }
 
 	///Dangerous function, use with care!!
 	///Skips next frame and compare similarity logic. Currently only used for unit tests.
 	cv::Mat _GetNextFrame() { cv::Mat ret; video >> ret; return ret; };
 
-private:
-	cv::VideoWriter CreateOutputVideoWritter(const fs::path& outputPath, cv::Size outputSize, double FPS);
+	//Output writers, shared with image sequences so their outputs look the same as a video's
+	static cv::VideoWriter CreateOutputVideoWritter(const fs::path& outputPath, cv::Size outputSize, double FPS);
 
-	void storeResultsInJSON(const std::vector<ResultBox>& res, int id, const std::string& timeStamp, std::ofstream& out);
+	static void storeResultsInFrame(cv::Mat frameCopy, const std::vector<ResultBox>& res, Media::SaveResultProperties props, bool decimals,
+		cv::VideoWriter out, cv::Size size);
+
+	//Contrast results also store their colorblind values when the media has colorblind frames
+	static void storeResultsInJSON(const FrameResults& results, int id, const std::string& timeStamp, std::ofstream& out, bool contrast = false);
+
+private:
 
 	cv::VideoCapture video;
 	cv::Mat currentFrame;
 	cv::Mat previousFrame;
 
 	int msTimeStamp;
-	static int framesToSkip;
-	static int fps;
+	int endFrame = INT_MAX; //frames from this one on are left to the next segment
+	int framesToSkip = 0;
+	int fps = 0;
+	int firstFrame = -1; //first loaded frame, -1 until loaded
+	int playbackFrame = 0; //real-time mode, frames before this one are dropped
 };
 
 }
\ No newline at end of file
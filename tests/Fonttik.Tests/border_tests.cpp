@@ -0,0 +1,46 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/Media.hpp"
+
+namespace tik {
+	TEST(BorderTests, FindsLetterbox) {
+		cv::Mat frame = cv::Mat::zeros(1080, 1920, CV_8UC3);
+		frame(cv::Rect(0, 140, 1920, 800)).setTo(cv::Scalar(40, 80, 120));
+
+		ASSERT_EQ(Media::findContentRect(frame, 16), cv::Rect(0, 140, 1920, 800));
+	}
+
+	TEST(BorderTests, FindsPillarbox) {
+		cv::Mat frame = cv::Mat::zeros(1080, 1920, CV_8UC3);
+		frame(cv::Rect(240, 0, 1440, 1080)).setTo(cv::Scalar::all(200));
+
+		ASSERT_EQ(Media::findContentRect(frame, 16), cv::Rect(240, 0, 1440, 1080));
+	}
+
+	TEST(BorderTests, PixelsUnderThresholdCountAsBorder) {
+		cv::Mat frame = cv::Mat::zeros(1080, 1920, CV_8UC3);
+		frame(cv::Rect(0, 140, 1920, 800)).setTo(cv::Scalar::all(5));
+		//A single bright pixel keeps its whole row and column
+		frame.at<cv::Vec3b>(500, 100) = cv::Vec3b(255, 255, 255);
+
+		cv::Rect content = Media::findContentRect(frame, 16);
+		ASSERT_EQ(content.y, 500);
+		ASSERT_EQ(content.height, 1);
+		ASSERT_EQ(content.x, 100);
+	}
+
+	TEST(BorderTests, IgnoresThinEdges) {
+		cv::Mat frame(1080, 1920, CV_8UC3, cv::Scalar::all(128));
+		frame.row(0).setTo(cv::Scalar::all(0));
+		frame.col(1919).setTo(cv::Scalar::all(0));
+
+		ASSERT_EQ(Media::findContentRect(frame, 16), cv::Rect(0, 0, 1920, 1080));
+	}
+
+	TEST(BorderTests, BlackFramesHaveNoContent) {
+		cv::Mat frame = cv::Mat::zeros(720, 1280, CV_8UC3);
+
+		ASSERT_TRUE(Media::findContentRect(frame, 16).empty());
+	}
+}
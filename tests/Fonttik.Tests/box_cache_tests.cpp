@@ -0,0 +1,81 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/BoxCache.hpp"
+#include "fonttik/Configuration.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+
+namespace tik {
+	class BoxCacheTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			config = Configuration("config/config_resolution.json");
+			config.setTargetResolution("1080");
+			params.boxCache = true;
+
+			frame = cv::Mat(200, 400, CV_8UC3, cv::Scalar(30, 30, 30));
+			frame(prompt).setTo(cv::Scalar(255, 255, 255));
+			frame(prompt + cv::Point(200, 100)).setTo(cv::Scalar(255, 255, 255));
+			frame(label).setTo(cv::Scalar(0, 0, 255));
+		}
+
+		//Stands in for a checker, one result per box in the given order, inside the box like size results
+		FrameResults check(int frameIndex, const std::vector<TextBox>& boxes) {
+			FrameResults results(frameIndex);
+			for (const TextBox& box : boxes) {
+				cv::Rect rect = box.getTextBoxRect();
+				results.results.push_back(ResultBox(ResultType::FAIL, rect.x + 2, rect.y + 3, rect.width - 4, rect.height - 6, 12, "Press A"));
+				results.results.back().passes = false;
+				results.overallPass = false;
+			}
+			return results;
+		}
+
+		Configuration config;
+		PerformanceParams params;
+		cv::Mat frame;
+		const cv::Rect prompt{ 20, 20, 100, 30 };
+		const cv::Rect label{ 20, 120, 150, 40 };
+	};
+
+	TEST_F(BoxCacheTests, ReusesIdenticalBoxesAnywhere) {
+		BoxCache cache(&config, params);
+
+		std::vector<TextBox> boxes = cache.match({ TextBox(prompt, frame) }, SIZE_CHECK, false);
+		ASSERT_EQ(boxes.size(), 1u);
+		FrameResults results = check(0, boxes);
+		cache.complete(results, SIZE_CHECK);
+		ASSERT_GT(cache.getMemoryUsage(), 0u);
+
+		//Same pixels somewhere else, only the label has to be checked
+		const cv::Rect moved = prompt + cv::Point(200, 100);
+		boxes = cache.match({ TextBox(label, frame), TextBox(moved, frame) }, SIZE_CHECK, false);
+		ASSERT_EQ(boxes.size(), 1u);
+		ASSERT_EQ(boxes[0].getTextBoxRect(), label);
+
+		results = check(1, boxes);
+		cache.complete(results, SIZE_CHECK);
+		ASSERT_EQ(results.results.size(), 2u);
+		ASSERT_EQ(results.results[0].x, label.x + 2);
+		ASSERT_EQ(results.results[1].x, moved.x + 2);
+		ASSERT_EQ(results.results[1].y, moved.y + 3);
+		ASSERT_EQ(results.results[1].text, "Press A");
+		ASSERT_FALSE(results.overallPass);
+
+		ASSERT_EQ(cache.getStats().hits, 1u);
+		ASSERT_EQ(cache.getStats().misses, 2u);
+	}
+
+	TEST_F(BoxCacheTests, SettingsArePartOfTheKey) {
+		BoxCache cache(&config, params);
+
+		std::vector<TextBox> boxes = cache.match({ TextBox(prompt, frame) }, CONTRAST_CHECK, false);
+		FrameResults results = check(0, boxes);
+		cache.complete(results, CONTRAST_CHECK);
+
+		//Results with colorblind values and size results are different entries
+		ASSERT_EQ(cache.match({ TextBox(prompt, frame) }, CONTRAST_CHECK, true).size(), 1u);
+		ASSERT_EQ(cache.match({ TextBox(prompt, frame) }, SIZE_CHECK, false).size(), 1u);
+		ASSERT_EQ(cache.match({ TextBox(prompt, frame) }, CONTRAST_CHECK, false).size(), 0u);
+	}
+}
@@ -0,0 +1,60 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/LRUCache.hpp"
+#include <string>
+
+namespace tik {
+	class LRUCacheTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			cache.put(1, "one");
+			cache.put(2, "two");
+		}
+
+		LRUCache<int, std::string> cache{ 2 };
+	};
+
+	TEST_F(LRUCacheTests, CountsHitsAndMisses) {
+		ASSERT_NE(cache.get(1), nullptr);
+		ASSERT_EQ(*cache.get(2), "two");
+		ASSERT_EQ(cache.get(3), nullptr);
+
+		ASSERT_EQ(cache.getStats().hits, 2u);
+		ASSERT_EQ(cache.getStats().misses, 1u);
+	}
+
+	TEST_F(LRUCacheTests, EvictsLeastRecentlyUsed) {
+		cache.get(1); //2 becomes the least recently used
+		cache.put(3, "three");
+
+		ASSERT_EQ(cache.size(), 2u);
+		ASSERT_EQ(cache.getStats().evictions, 1u);
+		ASSERT_EQ(cache.get(2), nullptr);
+		ASSERT_NE(cache.get(1), nullptr);
+		ASSERT_NE(cache.get(3), nullptr);
+	}
+
+	TEST_F(LRUCacheTests, ShrinkingCapacityEvicts) {
+		cache.setCapacity(1);
+
+		ASSERT_EQ(cache.size(), 1u);
+		ASSERT_NE(cache.get(2), nullptr);
+	}
+
+	TEST(WeightedLRUCacheTests, EvictsByWeight) {
+		LRUCache<int, std::string> weighted{ 100 };
+		weighted.put(1, "one", 40);
+		weighted.put(2, "two", 40);
+		ASSERT_EQ(weighted.weight(), 80u);
+
+		weighted.put(3, "three", 40);
+		ASSERT_EQ(weighted.size(), 2u);
+		ASSERT_EQ(weighted.weight(), 80u);
+		ASSERT_EQ(weighted.get(1), nullptr);
+
+		//Replacing an entry updates its weight
+		weighted.put(3, "three", 10);
+		ASSERT_EQ(weighted.weight(), 50u);
+	}
+}
@@ -0,0 +1,107 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/Fonttik.hpp"
+#include "fonttik/Configuration.hpp"
+#include "fonttik/Media.hpp"
+#include "fonttik/Log.h"
+#include "../../src/Video.hpp"
+#include <atomic>
+#include <thread>
+
+namespace tik {
+	//Run with BUILD_THREAD_SANITIZER to check for data races
+	class ConcurrencyTests : public ::testing::Test {
+	protected:
+		using MediaResults = std::pair<std::vector<FrameResults>, std::vector<FrameResults>>;
+
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			config = Configuration("config/config_resolution.json");
+		}
+
+		//Analyses a media with its own Fonttik, as every thread does
+		static MediaResults analyse(const Configuration& config, const std::string& path) {
+			Fonttik fonttik(&config);
+			Media* media = Media::createMedia(path);
+			Results results = fonttik.processMedia(*media);
+			delete media;
+			return { results.getSizeResults(), results.getContrastResults() };
+		}
+
+		static bool sameResults(const std::vector<FrameResults>& a, const std::vector<FrameResults>& b) {
+			if (a.size() != b.size()) {
+				return false;
+			}
+			for (size_t i = 0; i < a.size(); i++) {
+				if (a[i].results.size() != b[i].results.size() || a[i].overallType != b[i].overallType) {
+					return false;
+				}
+				for (size_t j = 0; j < a[i].results.size(); j++) {
+					const ResultBox& x = a[i].results[j];
+					const ResultBox& y = b[i].results[j];
+					if (x.type != y.type || x.x != y.x || x.y != y.y || x.width != y.width || x.height != y.height) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		Configuration config;
+		//Different resolutions so every thread needs a different guideline at the same time
+		const std::vector<std::string> images = {
+			"config/sizes/720SansPass.png",
+			"config/sizes/1080SansFail.png",
+			"config/sizes/4kSerifPass.png",
+			"config/sizes/1080ThinPass.png"
+		};
+	};
+
+	TEST_F(ConcurrencyTests, SharedConfigurationMatchesSequentialResults) {
+		std::vector<MediaResults> expected;
+		for (const std::string& image : images) {
+			expected.push_back(analyse(config, image));
+		}
+
+		const int threadCount = 4;
+		const int rounds = 2;
+		std::atomic<int> mismatches{ 0 };
+		std::vector<std::thread> threads;
+		for (int t = 0; t < threadCount; t++) {
+			threads.emplace_back([&, t]() {
+				for (int round = 0; round < rounds; round++) {
+					for (size_t i = 0; i < images.size(); i++) {
+						size_t image = (i + t) % images.size();
+						MediaResults results = analyse(config, images[image]);
+						if (!sameResults(results.first, expected[image].first) || !sameResults(results.second, expected[image].second)) {
+							mismatches++;
+						}
+					}
+				}
+			});
+		}
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		ASSERT_EQ(mismatches, 0);
+	}
+
+	TEST_F(ConcurrencyTests, SkipIntervalIsPerVideo) {
+		Video first("config/Video/LowSimilarity.gif");
+		Video second("config/Video/HighSimilarity.gif");
+		ASSERT_GT(first.getFps(), 0);
+		ASSERT_GT(second.getFps(), 0);
+
+		first.setAnalysisWaitSeconds(0);
+		second.setAnalysisWaitSeconds(5);
+		ASSERT_EQ(first.getFramesToSkip(), 0);
+		ASSERT_EQ(second.getFramesToSkip(), second.getFps() * 5);
+
+		//Configuring one video leaves the other one as it was
+		first.setAnalysisWaitSeconds(2);
+		ASSERT_EQ(first.getFramesToSkip(), first.getFps() * 2);
+		ASSERT_EQ(second.getFramesToSkip(), second.getFps() * 5);
+	}
+}
@@ -0,0 +1,79 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/DetectionCache.hpp"
+#include <filesystem>
+#include <fstream>
+
+namespace tik {
+	class DetectionCacheTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			path = (std::filesystem::temp_directory_path() / "fonttik_detection_cache_test.bin").string();
+			std::filesystem::remove(path);
+
+			detection.words = { cv::Rect(10, 20, 100, 30), cv::Rect(120, 20, 80, 30) };
+			detection.lines = { cv::Rect(10, 20, 190, 30) };
+		}
+
+		void TearDown() override {
+			std::filesystem::remove(path);
+		}
+
+		std::string path;
+		DetectionCache::Detection detection;
+	};
+
+	TEST_F(DetectionCacheTests, RecordsSurviveReopening) {
+		{
+			DetectionCache cache(path);
+			ASSERT_FALSE(cache.getDetection(1, 2).has_value());
+			cache.putDetection(1, 2, detection);
+			cache.putText(3, 4, "Continue");
+		}
+
+		DetectionCache cache(path);
+		ASSERT_EQ(cache.size(), 2u);
+
+		std::optional<DetectionCache::Detection> loaded = cache.getDetection(1, 2);
+		ASSERT_TRUE(loaded.has_value());
+		ASSERT_EQ(loaded->words, detection.words);
+		ASSERT_EQ(loaded->lines, detection.lines);
+		ASSERT_EQ(cache.getText(3, 4).value(), "Continue");
+
+		//Different settings are different records
+		ASSERT_FALSE(cache.getDetection(1, 5).has_value());
+		ASSERT_FALSE(cache.getText(1, 2).has_value());
+		ASSERT_EQ(cache.getDetectionStats().hits, 1u);
+		ASSERT_EQ(cache.getDetectionStats().misses, 1u);
+	}
+
+	TEST_F(DetectionCacheTests, IgnoresTruncatedRecords) {
+		{
+			DetectionCache cache(path);
+			cache.putDetection(1, 2, detection);
+			cache.putDetection(6, 2, detection);
+		}
+
+		//Cut the last record in half as if the run had been killed while writing it
+		std::filesystem::resize_file(path, std::filesystem::file_size(path) - 10);
+
+		{
+			DetectionCache cache(path);
+			ASSERT_TRUE(cache.getDetection(1, 2).has_value());
+			ASSERT_FALSE(cache.getDetection(6, 2).has_value());
+			cache.putText(3, 4, "Back");
+		}
+
+		//Records appended after the damaged part are readable
+		DetectionCache cache(path);
+		ASSERT_TRUE(cache.getDetection(1, 2).has_value());
+		ASSERT_EQ(cache.getText(3, 4).value(), "Back");
+	}
+
+	TEST_F(DetectionCacheTests, OpenSharesCachesPerFile) {
+		std::shared_ptr<DetectionCache> first = DetectionCache::open(path);
+		std::shared_ptr<DetectionCache> second = DetectionCache::open(path);
+		ASSERT_EQ(first.get(), second.get());
+	}
+}
@@ -0,0 +1,82 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/DuplicateFinder.hpp"
+#include <opencv2/imgproc.hpp>
+#include <nlohmann/json.hpp>
+#include <fstream>
+
+namespace tik {
+	class DuplicateFinderTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			menu = cv::Mat(360, 640, CV_8UC3, cv::Scalar(40, 30, 20));
+			cv::rectangle(menu, cv::Rect(40, 40, 200, 280), cv::Scalar(200, 200, 200), cv::FILLED);
+			cv::putText(menu, "Options", cv::Point(300, 100), cv::FONT_HERSHEY_SIMPLEX, 1.5, cv::Scalar(255, 255, 255), 3);
+
+			gameplay = cv::Mat(360, 640, CV_8UC3);
+			cv::randu(gameplay, cv::Scalar::all(0), cv::Scalar::all(255));
+			cv::GaussianBlur(gameplay, gameplay, cv::Size(31, 31), 0);
+		}
+
+		cv::Mat menu, gameplay;
+	};
+
+	TEST_F(DuplicateFinderTests, NearDuplicatesAreClose) {
+		cv::Mat brighter;
+		menu.convertTo(brighter, -1, 1.0, 6);
+		cv::Mat noisy = menu.clone();
+		cv::Mat noise(menu.size(), CV_8UC3);
+		cv::randu(noise, cv::Scalar::all(0), cv::Scalar::all(4));
+		noisy += noise;
+
+		uint64_t hash = DuplicateFinder::perceptualHash(menu);
+		ASSERT_EQ(DuplicateFinder::perceptualHash(menu.clone()), hash);
+		ASSERT_LE(DuplicateFinder::distance(DuplicateFinder::perceptualHash(brighter), hash), 4);
+		ASSERT_LE(DuplicateFinder::distance(DuplicateFinder::perceptualHash(noisy), hash), 4);
+		ASSERT_GT(DuplicateFinder::distance(DuplicateFinder::perceptualHash(gameplay), hash), 10);
+	}
+
+	TEST(DuplicateGroupingTests, GroupsByDistanceAndSize) {
+		const cv::Size hd(1920, 1080);
+		std::vector<DuplicateFinder::ImageHash> hashes = {
+			{ 0b0000, hd },
+			{ 0xFFFF0000, hd },
+			{ 0b0011, hd }, //2 bits away from the first
+			{ 0b0001, cv::Size(1280, 720) }, //close but a different size
+			{ 0b0000, cv::Size() } //not an image
+		};
+
+		std::vector<std::vector<size_t>> groups = DuplicateFinder::groupHashes(hashes, 2);
+		ASSERT_EQ(groups.size(), 4u);
+		ASSERT_EQ(groups[0], (std::vector<size_t>{ 0, 2 }));
+		ASSERT_EQ(groups[1], (std::vector<size_t>{ 1 }));
+		ASSERT_EQ(groups[2], (std::vector<size_t>{ 3 }));
+		ASSERT_EQ(groups[3], (std::vector<size_t>{ 4 }));
+
+		ASSERT_EQ(DuplicateFinder::groupHashes(hashes, 0).size(), 5u);
+	}
+
+	TEST(DuplicateResultsTests, CopiesResultsWithTheirOrigin) {
+		fs::path root = fs::temp_directory_path() / "fonttik_duplicate_test";
+		fs::remove_all(root);
+		fs::path representative = root / "menu_output";
+		fs::path duplicate = root / "menu2_output";
+		fs::create_directories(representative);
+		std::ofstream(representative / "sizeChecks.json") << R"([{"frame":0,"boxes":[]}])";
+		std::ofstream(representative / "contrastChecks.json") << R"([{"frame":0,"boxes":[]}])";
+
+		ASSERT_TRUE(DuplicateFinder::copyResults(representative, duplicate, "menu.png"));
+		std::ifstream in(duplicate / "contrastChecks.json");
+		nlohmann::json results = nlohmann::json::parse(in);
+		ASSERT_EQ(results[0]["deduplicatedFrom"], "menu.png");
+		ASSERT_EQ(results[0]["frame"], 0);
+
+		//Missing results of the representative can't be copied
+		fs::remove(representative / "sizeChecks.json");
+		ASSERT_FALSE(DuplicateFinder::copyResults(representative, duplicate, "menu.png"));
+
+		in.close();
+		fs::remove_all(root);
+	}
+}
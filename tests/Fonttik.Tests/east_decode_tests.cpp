@@ -0,0 +1,86 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/EASTDecoder.hpp"
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+
+namespace tik {
+	class EASTDecoderTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			int scoreSizes[] = { 1, 1, 8, 8 };
+			int geometrySizes[] = { 1, 5, 8, 8 };
+			scores = cv::Mat(4, scoreSizes, CV_32F);
+			scores = cv::Scalar(0);
+			geometry = cv::Mat(4, geometrySizes, CV_32F);
+			geometry = cv::Scalar(0);
+
+			//Single confident cell at (2,3) predicting an axis aligned 16x8 box
+			const int cell = 3 * 8 + 2;
+			scores.ptr<float>()[cell] = 0.9f;
+			float* distances = geometry.ptr<float>();
+			distances[0 * 64 + cell] = 4; //top
+			distances[1 * 64 + cell] = 8; //right
+			distances[2 * 64 + cell] = 4; //bottom
+			distances[3 * 64 + cell] = 8; //left
+			distances[4 * 64 + cell] = 0; //angle
+		}
+
+		cv::Mat scores, geometry;
+	};
+
+	TEST_F(EASTDecoderTests, DecodesGeometry) {
+		std::vector<EASTDecoder::Quad> quads;
+		std::vector<float> confidences;
+		EASTDecoder::decode(scores, geometry, 0.5f, { 32, 32 }, { 32, 32 }, quads, confidences);
+
+		ASSERT_EQ(quads.size(), 1u);
+		ASSERT_FLOAT_EQ(confidences[0], 0.9f);
+
+		float minX = quads[0][0].x, maxX = minX, minY = quads[0][0].y, maxY = minY;
+		for (const cv::Point2f& point : quads[0]) {
+			minX = std::min(minX, point.x);
+			maxX = std::max(maxX, point.x);
+			minY = std::min(minY, point.y);
+			maxY = std::max(maxY, point.y);
+		}
+		ASSERT_NEAR(minX, 0, 0.01);
+		ASSERT_NEAR(minY, 8, 0.01);
+		ASSERT_NEAR(maxX, 16, 0.01);
+		ASSERT_NEAR(maxY, 16, 0.01);
+	}
+
+	TEST_F(EASTDecoderTests, RescalesToFrame) {
+		auto boxes = EASTDecoder::detect(scores, geometry, 0.5f, 0.4f, { 32, 32 }, { 64, 64 });
+
+		ASSERT_EQ(boxes.size(), 1u);
+		cv::Rect bounds = cv::boundingRect(boxes[0]);
+		ASSERT_EQ(bounds.tl(), cv::Point(0, 16));
+		ASSERT_EQ(bounds.br(), cv::Point(33, 33)); //boundingRect is inclusive of the corner at (32,32)
+	}
+
+	TEST_F(EASTDecoderTests, IgnoresCellsBelowThreshold) {
+		std::vector<EASTDecoder::Quad> quads;
+		std::vector<float> confidences;
+		EASTDecoder::decode(scores, geometry, 0.95f, { 32, 32 }, { 32, 32 }, quads, confidences);
+
+		ASSERT_TRUE(quads.empty());
+	}
+
+	TEST(EASTSuppressionTests, SuppressesOverlappingBoxes) {
+		std::vector<EASTDecoder::Quad> quads = {
+			EASTDecoder::Quad{ cv::Point2f(0, 20), cv::Point2f(0, 0), cv::Point2f(40, 0), cv::Point2f(40, 20) },
+			EASTDecoder::Quad{ cv::Point2f(2, 21), cv::Point2f(2, 1), cv::Point2f(42, 1), cv::Point2f(42, 21) },
+			EASTDecoder::Quad{ cv::Point2f(200, 120), cv::Point2f(200, 100), cv::Point2f(240, 100), cv::Point2f(240, 120) }
+		};
+		std::vector<float> confidences = { 0.7f, 0.9f, 0.8f };
+
+		std::vector<int> kept = EASTDecoder::suppress(quads, confidences, 0.4f);
+
+		//The most confident of the overlapping pair survives, the distant box is untouched
+		ASSERT_EQ(kept.size(), 2u);
+		ASSERT_EQ(kept[0], 1);
+		ASSERT_EQ(kept[1], 2);
+	}
+}
@@ -0,0 +1,83 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/HudLayout.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+
+namespace tik {
+	class HudLayoutTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			params.hudLayout = true;
+			params.hudLearningFrames = 3;
+			params.hudRescanInterval = 5;
+			params.hudRegionMargin = 8;
+			params.hudMaxRegions = 2;
+		}
+
+		//Runs the learning frames with the same boxes on every one of them
+		void learn(HudLayout& layout, const std::vector<cv::Rect>& boxes) {
+			for (int i = 0; i < params.hudLearningFrames; i++) {
+				ASSERT_TRUE(layout.planFrame(frameSize).fullScan);
+				layout.addDetections(boxes);
+			}
+		}
+
+		PerformanceParams params;
+		const cv::Size frameSize{ 1920, 1080 };
+	};
+
+	TEST_F(HudLayoutTests, RestrictsToLearnedRegions) {
+		HudLayout layout(params);
+		learn(layout, { cv::Rect(32, 32, 200, 40), cv::Rect(1600, 1000, 256, 48) });
+
+		HudLayout::Plan plan = layout.planFrame(frameSize);
+		ASSERT_FALSE(plan.fullScan);
+		ASSERT_EQ(plan.regions.size(), 2u);
+
+		for (const cv::Rect& box : { cv::Rect(32, 32, 200, 40), cv::Rect(1600, 1000, 256, 48) }) {
+			bool covered = false;
+			for (const cv::Rect& region : plan.regions) {
+				covered = covered || (region & box) == box;
+			}
+			ASSERT_TRUE(covered);
+		}
+		ASSERT_LT(layout.getStats().regionCoverage, 0.1);
+	}
+
+	TEST_F(HudLayoutTests, RescansPeriodically) {
+		HudLayout layout(params);
+		learn(layout, { cv::Rect(32, 32, 200, 40) });
+
+		for (int i = 0; i < params.hudRescanInterval; i++) {
+			ASSERT_FALSE(layout.planFrame(frameSize).fullScan);
+		}
+		ASSERT_TRUE(layout.planFrame(frameSize).fullScan);
+		ASSERT_EQ(layout.getStats().fullScans, 4u);
+		ASSERT_EQ(layout.getStats().regionScans, 5u);
+	}
+
+	TEST_F(HudLayoutTests, MergesRegionsOverLimit) {
+		HudLayout layout(params);
+		learn(layout, { cv::Rect(32, 32, 64, 32), cv::Rect(400, 32, 64, 32), cv::Rect(1600, 1000, 64, 32) });
+
+		HudLayout::Plan plan = layout.planFrame(frameSize);
+		ASSERT_EQ(plan.regions.size(), 2u);
+	}
+
+	TEST_F(HudLayoutTests, EmptyLayoutSkipsDetection) {
+		HudLayout layout(params);
+		learn(layout, {});
+
+		HudLayout::Plan plan = layout.planFrame(frameSize);
+		ASSERT_FALSE(plan.fullScan);
+		ASSERT_TRUE(plan.regions.empty());
+	}
+
+	TEST_F(HudLayoutTests, FrameSizeChangeRestartsLearning) {
+		HudLayout layout(params);
+		learn(layout, { cv::Rect(32, 32, 200, 40) });
+
+		ASSERT_TRUE(layout.planFrame(cv::Size(1280, 720)).fullScan);
+	}
+}
@@ -0,0 +1,103 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/ImageSequence.hpp"
+#include "fonttik/Frame.hpp"
+#include "fonttik/Log.h"
+#include <opencv2/imgcodecs.hpp>
+#include <fstream>
+#include <memory>
+
+namespace tik {
+	class ImageSequenceTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			fs::remove_all(folder);
+			fs::create_directories(folder);
+		}
+
+		void TearDown() override {
+			fs::remove_all(folder);
+		}
+
+		void writeImage(const std::string& name, int gray) {
+			cv::imwrite((folder / name).string(), cv::Mat(8, 8, CV_8UC3, cv::Scalar(gray, gray, gray)));
+		}
+
+		std::vector<std::string> names(const std::vector<fs::path>& frames) {
+			std::vector<std::string> result;
+			for (const fs::path& frame : frames) {
+				result.push_back(frame.filename().string());
+			}
+			return result;
+		}
+
+		const fs::path folder = fs::temp_directory_path() / "fonttik_sequence_tests";
+	};
+
+	TEST_F(ImageSequenceTests, RecognisesPatterns) {
+		ASSERT_TRUE(ImageSequence::isPattern("shots/frame_%05d.png"));
+		ASSERT_TRUE(ImageSequence::isPattern("frame_%d.jpg"));
+		ASSERT_FALSE(ImageSequence::isPattern("shots/frame_00001.png"));
+		ASSERT_FALSE(ImageSequence::isPattern("frame_%s.png"));
+		ASSERT_FALSE(ImageSequence::isPattern("frame_%d_%d.png"));
+	}
+
+	TEST_F(ImageSequenceTests, FindsPatternFramesInNumberOrder) {
+		for (const char* name : { "frame_0010.png", "frame_0002.png", "frame_0001.png", "frame_10.png", "other_0003.png" }) {
+			std::ofstream(folder / name) << "x";
+		}
+
+		//frame_10.png doesn't have the padding of the pattern
+		std::vector<fs::path> frames = ImageSequence::findPatternFrames((folder / "frame_%04d.png").string());
+		ASSERT_EQ(names(frames), std::vector<std::string>({ "frame_0001.png", "frame_0002.png", "frame_0010.png" }));
+	}
+
+	TEST_F(ImageSequenceTests, SortsFolderImages) {
+		writeImage("shot_10.png", 0);
+		writeImage("shot_2.png", 0);
+		writeImage("shot_1.png", 0);
+		std::ofstream(folder / "notes.txt") << "not an image";
+
+		ASSERT_EQ(names(ImageSequence::findDirectoryFrames(folder, SequenceOrder::Natural)),
+			std::vector<std::string>({ "shot_1.png", "shot_2.png", "shot_10.png" }));
+		ASSERT_EQ(names(ImageSequence::findDirectoryFrames(folder, SequenceOrder::Name)),
+			std::vector<std::string>({ "shot_1.png", "shot_10.png", "shot_2.png" }));
+	}
+
+	TEST_F(ImageSequenceTests, SkipsSimilarFramesLikeVideos) {
+		for (int i = 0; i < 6; i++) {
+			writeImage("frame_" + std::to_string(i) + ".png", (i == 2 || i == 3) ? 255 : 0);
+		}
+
+		std::unique_ptr<ImageSequence> sequence(ImageSequence::fromPattern((folder / "frame_%d.png").string()));
+		ASSERT_NE(sequence, nullptr);
+		ASSERT_EQ(sequence->getFrameCount(), 6);
+		ASSERT_EQ(sequence->getImageSize(), cv::Size(8, 8));
+
+		for (int expected : { 0, 2, 4 }) {
+			ASSERT_TRUE(sequence->loadFrame());
+			ASSERT_EQ(sequence->getFrame().getFrameIndex(), expected);
+		}
+		ASSERT_FALSE(sequence->loadFrame());
+	}
+
+	TEST_F(ImageSequenceTests, SkipsFramesByAnalysisWait) {
+		//Alternating black and white frames, every second one is similar to the last analysed one
+		for (int i = 0; i < 6; i++) {
+			writeImage("frame_" + std::to_string(i) + ".png", (i % 2) ? 255 : 0);
+		}
+
+		//4 frames per second, the frame after the skip interval is 3 frames later as in videos
+		std::unique_ptr<ImageSequence> sequence(ImageSequence::fromDirectory(folder, SequenceOrder::Natural, 4));
+		ASSERT_NE(sequence, nullptr);
+		sequence->setAnalysisWaitSeconds(1);
+
+		for (int expected : { 0, 3 }) {
+			ASSERT_TRUE(sequence->loadFrame());
+			ASSERT_EQ(sequence->getFrame().getFrameIndex(), expected);
+		}
+		ASSERT_FALSE(sequence->loadFrame());
+	}
+}
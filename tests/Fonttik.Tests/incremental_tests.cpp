@@ -0,0 +1,95 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/IncrementalAnalysis.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+
+namespace tik {
+	class IncrementalAnalysisTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			params.incrementalAnalysis = true;
+			params.incrementalTileSize = 32;
+			params.incrementalMargin = 8;
+			params.incrementalPixelThreshold = 12;
+			params.incrementalMaxChangedArea = 0.5f;
+
+			frame = cv::Mat(360, 640, CV_8UC3, cv::Scalar(40, 40, 40));
+			cv::putText(frame, "Score 100", cv::Point(20, 40), cv::FONT_HERSHEY_SIMPLEX, 1.0, cv::Scalar(255, 255, 255), 2);
+		}
+
+		PerformanceParams params;
+		cv::Mat frame;
+	};
+
+	TEST_F(IncrementalAnalysisTests, FirstFrameIsFull) {
+		IncrementalAnalysis incremental(params);
+		ASSERT_TRUE(incremental.findChanges(frame).full);
+	}
+
+	TEST_F(IncrementalAnalysisTests, IdenticalFrameHasNoChanges) {
+		IncrementalAnalysis incremental(params);
+		FrameResults size(0), contrast(0);
+		incremental.findChanges(frame);
+		incremental.store(frame, size, contrast);
+
+		IncrementalAnalysis::Update update = incremental.findChanges(frame.clone());
+		ASSERT_FALSE(update.full);
+		ASSERT_TRUE(update.regions.empty());
+	}
+
+	TEST_F(IncrementalAnalysisTests, SmallChangeGivesCoveringRegion) {
+		IncrementalAnalysis incremental(params);
+		FrameResults size(0), contrast(0);
+		incremental.findChanges(frame);
+		incremental.store(frame, size, contrast);
+
+		cv::Mat next = frame.clone();
+		cv::Rect patch(400, 250, 60, 30);
+		next(patch).setTo(cv::Scalar(200, 200, 200));
+
+		IncrementalAnalysis::Update update = incremental.findChanges(next);
+		ASSERT_FALSE(update.full);
+		ASSERT_EQ(update.regions.size(), 1u);
+		ASSERT_EQ(update.regions[0] & patch, patch);
+	}
+
+	TEST_F(IncrementalAnalysisTests, LargeChangeIsFull) {
+		IncrementalAnalysis incremental(params);
+		FrameResults size(0), contrast(0);
+		incremental.findChanges(frame);
+		incremental.store(frame, size, contrast);
+
+		cv::Mat next = frame.clone();
+		next(cv::Rect(0, 0, 640, 240)).setTo(cv::Scalar(200, 200, 200));
+
+		ASSERT_TRUE(incremental.findChanges(next).full);
+	}
+
+	TEST_F(IncrementalAnalysisTests, CarriesOverUnchangedBoxes) {
+		IncrementalAnalysis incremental(params);
+		FrameResults size(0), contrast(0);
+		size.results.emplace_back(ResultType::FAIL, cv::Rect(20, 15, 150, 30), 18.0);
+		size.results.back().passes = false;
+		size.results.emplace_back(ResultType::PASS, cv::Rect(400, 250, 60, 30), 40.0);
+		contrast.results.emplace_back(ResultType::PASS, cv::Rect(20, 15, 150, 30), 7.0);
+		incremental.findChanges(frame);
+		incremental.store(frame, size, contrast);
+
+		cv::Mat next = frame.clone();
+		next(cv::Rect(400, 250, 60, 30)).setTo(cv::Scalar(200, 200, 200));
+		IncrementalAnalysis::Update update = incremental.findChanges(next);
+		ASSERT_FALSE(update.full);
+
+		FrameResults nextSize(1), nextContrast(1);
+		incremental.carryOver(update.regions, nextSize, nextContrast);
+
+		//Only the box outside of the changed region survives, still marked as measured on the first frame
+		ASSERT_EQ(nextSize.results.size(), 1u);
+		ASSERT_EQ(nextSize.results[0].x, 20);
+		ASSERT_EQ(nextSize.results[0].measuredFrame, 0);
+		ASSERT_FALSE(nextSize.overallPass);
+		ASSERT_EQ(nextContrast.results.size(), 1u);
+		ASSERT_TRUE(nextContrast.overallPass);
+	}
+}
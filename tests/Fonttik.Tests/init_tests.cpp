@@ -0,0 +1,101 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/Fonttik.hpp"
+#include "fonttik/Configuration.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Media.hpp"
+#include "fonttik/Log.h"
+#include <memory>
+
+namespace tik {
+	class InitTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			config = Configuration("config/config_resolution.json");
+		}
+
+		void setLoading(bool parallel, bool warmUp) {
+			PerformanceParams params = config.getPerformanceParams();
+			params.parallelModelLoading = parallel;
+			params.warmUpModels = warmUp;
+			config.setPerformanceParams(params);
+		}
+
+		Results analyse(Fonttik& fonttik, const std::string& path) {
+			std::unique_ptr<Media> media(Media::createMedia(path));
+			return fonttik.processMedia(*media);
+		}
+
+		static void expectSameResults(const std::vector<FrameResults>& a, const std::vector<FrameResults>& b) {
+			ASSERT_EQ(a.size(), b.size());
+			for (size_t i = 0; i < a.size(); i++) {
+				ASSERT_EQ(a[i].overallType, b[i].overallType);
+				ASSERT_EQ(a[i].results.size(), b[i].results.size());
+				for (size_t j = 0; j < a[i].results.size(); j++) {
+					const ResultBox& x = a[i].results[j];
+					const ResultBox& y = b[i].results[j];
+					ASSERT_EQ(x.type, y.type);
+					ASSERT_EQ(cv::Rect(x.x, x.y, x.width, x.height), cv::Rect(y.x, y.y, y.width, y.height));
+					ASSERT_EQ(x.text, y.text);
+				}
+			}
+		}
+
+		Configuration config;
+	};
+
+	TEST_F(InitTests, LoadsEveryEnabledModel) {
+		setLoading(true, false);
+		config.setUseOcr(true);
+		Fonttik fonttik(&config);
+
+		InitStats stats = fonttik.getMetrics().init;
+		ASSERT_TRUE(stats.detectionLoaded);
+		ASSERT_TRUE(stats.recognitionLoaded);
+		ASSERT_GT(stats.totalMs, 0);
+	}
+
+	TEST_F(InitTests, LoadsRecognitionOnlyOnceEnabled) {
+		config.setUseOcr(false);
+		Fonttik fonttik(&config);
+		ASSERT_TRUE(fonttik.getMetrics().init.detectionLoaded);
+		ASSERT_FALSE(fonttik.getMetrics().init.recognitionLoaded);
+
+		//Analysing with recognition enabled loads it on demand
+		config.setUseOcr(true);
+		analyse(fonttik, "config/sizes/1080SansFail.png");
+		ASSERT_TRUE(fonttik.getMetrics().init.recognitionLoaded);
+	}
+
+	TEST_F(InitTests, WarmsUpOnlyWhenEnabled) {
+		config.setUseOcr(true);
+
+		setLoading(true, true);
+		Fonttik warmed(&config);
+		ASSERT_GT(warmed.getMetrics().init.detectionWarmUpMs, 0);
+		ASSERT_GT(warmed.getMetrics().init.recognitionWarmUpMs, 0);
+
+		setLoading(true, false);
+		Fonttik cold(&config);
+		ASSERT_EQ(cold.getMetrics().init.detectionWarmUpMs, 0);
+		ASSERT_EQ(cold.getMetrics().init.recognitionWarmUpMs, 0);
+	}
+
+	TEST_F(InitTests, ParallelInitMatchesSequentialInit) {
+		config.setUseOcr(true);
+		const std::string path = "config/sizes/1080SansFail.png";
+
+		setLoading(false, false);
+		Fonttik sequential(&config);
+		Results expected = analyse(sequential, path);
+
+		setLoading(true, true);
+		Fonttik parallel(&config);
+		Results results = analyse(parallel, path);
+
+		expectSameResults(results.getSizeResults(), expected.getSizeResults());
+		expectSameResults(results.getContrastResults(), expected.getContrastResults());
+	}
+}
@@ -0,0 +1,32 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/TextboxDetectionDB.h"
+
+namespace tik {
+	TEST(DBInputSizeTests, KeepsAspectRatioUnderBudget) {
+		cv::Size inputSize = TextboxDetectionDB::computeInputSize({ 1920, 1080 }, 736 * 736, 32);
+
+		ASSERT_EQ(inputSize, cv::Size(960, 544));
+		ASSERT_LE(inputSize.area(), 736 * 736);
+	}
+
+	TEST(DBInputSizeTests, RoundsToStride) {
+		cv::Size inputSize = TextboxDetectionDB::computeInputSize({ 2560, 1080 }, 640 * 640, 32);
+
+		ASSERT_EQ(inputSize.width % 32, 0);
+		ASSERT_EQ(inputSize.height % 32, 0);
+		ASSERT_LE(inputSize.area(), 640 * 640);
+		ASSERT_GT(inputSize.width, 2 * inputSize.height);
+	}
+
+	TEST(DBInputSizeTests, SquareFramesKeepSquareInputs) {
+		ASSERT_EQ(TextboxDetectionDB::computeInputSize({ 1000, 1000 }, 736 * 736, 32), cv::Size(736, 736));
+	}
+
+	TEST(DBInputSizeTests, NeverBelowStride) {
+		cv::Size inputSize = TextboxDetectionDB::computeInputSize({ 4000, 10 }, 64 * 64, 32);
+
+		ASSERT_EQ(inputSize.height, 32);
+	}
+}
@@ -0,0 +1,71 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/OutputManifest.hpp"
+#include <fstream>
+
+namespace tik {
+	class OutputManifestTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			root = fs::temp_directory_path() / "fonttik_manifest_test";
+			fs::remove_all(root);
+			outputPath = root / "capture_output";
+			fs::create_directories(outputPath);
+
+			input = root / "capture.png";
+			write(input, "first capture");
+			write(outputPath / "sizeChecks.json", "[]");
+			write(outputPath / "contrastChecks.json", "[]");
+		}
+
+		void TearDown() override {
+			fs::remove_all(root);
+		}
+
+		static void write(const fs::path& path, const std::string& contents) {
+			std::ofstream out(path, std::ios::binary);
+			out << contents;
+		}
+
+		fs::path root, outputPath, input;
+	};
+
+	TEST_F(OutputManifestTests, MissingManifestIsOutdated) {
+		ASSERT_FALSE(OutputManifest(input, 1).isUpToDate(outputPath));
+	}
+
+	TEST_F(OutputManifestTests, SavedManifestIsUpToDate) {
+		OutputManifest(input, 1).save(outputPath);
+
+		ASSERT_TRUE(OutputManifest(input, 1).isUpToDate(outputPath));
+		ASSERT_FALSE(OutputManifest(input, 2).isUpToDate(outputPath));
+	}
+
+	TEST_F(OutputManifestTests, ChangedContentsAreOutdated) {
+		OutputManifest(input, 1).save(outputPath);
+
+		write(input, "a longer capture");
+		ASSERT_FALSE(OutputManifest(input, 1).isUpToDate(outputPath));
+
+		//Same size, only the content hash tells them apart
+		OutputManifest(input, 1).save(outputPath);
+		write(input, "a second capture");
+		fs::last_write_time(input, fs::last_write_time(input) + std::chrono::hours(1));
+		ASSERT_FALSE(OutputManifest(input, 1).isUpToDate(outputPath));
+	}
+
+	TEST_F(OutputManifestTests, TouchedFilesAreUpToDate) {
+		OutputManifest(input, 1).save(outputPath);
+
+		fs::last_write_time(input, fs::last_write_time(input) + std::chrono::hours(1));
+		ASSERT_TRUE(OutputManifest(input, 1).isUpToDate(outputPath));
+	}
+
+	TEST_F(OutputManifestTests, MissingResultsAreOutdated) {
+		OutputManifest(input, 1).save(outputPath);
+
+		fs::remove(outputPath / "contrastChecks.json");
+		ASSERT_FALSE(OutputManifest(input, 1).isUpToDate(outputPath));
+	}
+}
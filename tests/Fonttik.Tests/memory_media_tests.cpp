@@ -0,0 +1,105 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/Fonttik.hpp"
+#include "fonttik/Configuration.hpp"
+#include "fonttik/MemoryMedia.hpp"
+#include "fonttik/Log.h"
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <nlohmann/json.hpp>
+#include <fstream>
+
+namespace tik {
+	class MemoryMediaTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			config = Configuration("config/config_resolution.json");
+		}
+
+		Configuration config;
+	};
+
+	TEST_F(MemoryMediaTests, WrapsBgrBufferInPlace) {
+		//Rows padded to 64 bytes like most capture APIs do
+		const int width = 10, height = 4;
+		const size_t stride = 64;
+		std::vector<uint8_t> pixels(stride * height, 7);
+
+		FrameBuffer buffer{ pixels.data(), width, height, stride, PixelFormat::BGR, 3, 100 };
+		cv::Mat wrapped = MemoryMedia::wrapBuffer(buffer);
+
+		ASSERT_EQ(wrapped.data, pixels.data());
+		ASSERT_EQ(wrapped.step, stride);
+		ASSERT_EQ(wrapped.size(), cv::Size(width, height));
+	}
+
+	TEST_F(MemoryMediaTests, ConvertsRgbaToBgr) {
+		std::vector<uint8_t> pixels = { 10, 20, 30, 255 };
+		FrameBuffer buffer{ pixels.data(), 1, 1, 0, PixelFormat::RGBA };
+
+		cv::Mat wrapped = MemoryMedia::wrapBuffer(buffer);
+
+		ASSERT_EQ(wrapped.type(), CV_8UC3);
+		ASSERT_EQ(wrapped.at<cv::Vec3b>(0, 0), cv::Vec3b(30, 20, 10));
+	}
+
+	TEST_F(MemoryMediaTests, RejectsInvalidBuffers) {
+		MemoryMedia media("capture", { 10, 4 });
+		std::vector<uint8_t> pixels(10 * 4 * 3);
+
+		ASSERT_FALSE(media.pushFrame(FrameBuffer{ pixels.data(), 8, 4 }));
+		ASSERT_FALSE(media.pushFrame(FrameBuffer{ pixels.data(), 10, 4, 20 })); //stride shorter than a row
+		ASSERT_FALSE(media.loadFrame());
+
+		ASSERT_TRUE(media.pushFrame(FrameBuffer{ pixels.data(), 10, 4 }));
+		ASSERT_TRUE(media.loadFrame());
+		ASSERT_FALSE(media.loadFrame()); //each pushed frame is only loaded once
+	}
+
+	TEST_F(MemoryMediaTests, MatchesImageResults) {
+		const std::string path = "config/sizes/1080SansFail.png";
+		Fonttik fonttik(&config);
+		Media* image = Media::createMedia(path);
+		Results expected = fonttik.processMedia(*image);
+		delete image;
+
+		//Same image handed over as a BGRA capture
+		cv::Mat bgra;
+		cv::cvtColor(cv::imread(path), bgra, cv::COLOR_BGR2BGRA);
+		MemoryMedia media("capture", bgra.size());
+		ASSERT_TRUE(fonttik.beginMedia(media));
+
+		FrameBuffer buffer{ bgra.data, bgra.cols, bgra.rows, bgra.step, PixelFormat::BGRA, 5, 200 };
+		ASSERT_TRUE(media.pushFrame(buffer));
+		ASSERT_TRUE(media.loadFrame());
+		std::pair<FrameResults, FrameResults> results = fonttik.processFrame(media);
+
+		ASSERT_EQ(results.first.frame, 5);
+		ASSERT_EQ(results.first.overallPass, expected.sizePass());
+		ASSERT_EQ(results.first.results.size(), expected.getSizeResults()[0].results.size());
+		ASSERT_EQ(results.second.results.size(), expected.getContrastResults()[0].results.size());
+	}
+
+	TEST_F(MemoryMediaTests, AsyncStoresResultsOfEveryFrame) {
+		cv::Mat image = cv::imread("config/sizes/1080SansFail.png");
+		Fonttik fonttik(&config);
+		MemoryMedia media("capture", image.size());
+		ASSERT_TRUE(media.pushFrame(image, 7, 300));
+
+		AsyncResults results = fonttik.processMediaAsync(media);
+
+		//Outlines are named after their frame so later frames don't overwrite them
+		ASSERT_FALSE(results.pathToJSONSizeResult.empty());
+		ASSERT_TRUE(fs::exists(media.getOutputPath() / "sizeChecks_7.png"));
+		ASSERT_TRUE(fs::exists(media.getOutputPath() / "contrastChecks_7.png"));
+
+		for (const fs::path& path : { results.pathToJSONSizeResult, results.pathToJSONContrastResult }) {
+			std::ifstream in(path);
+			nlohmann::json frames = nlohmann::json::parse(in);
+			ASSERT_EQ(frames.size(), 1);
+			ASSERT_EQ(frames[0]["id"], 7);
+		}
+	}
+}
@@ -0,0 +1,77 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/Log.h"
+#include "../../src/ModelRegistry.hpp"
+#include <thread>
+
+namespace tik {
+	class ModelRegistryTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+		}
+
+		void TearDown() override {
+			ModelRegistry::getInstance().clear();
+		}
+
+		const std::string model = "crnn_cs.onnx";
+	};
+
+	TEST_F(ModelRegistryTests, SameContextSharesNetwork) {
+		ModelRegistry& registry = ModelRegistry::getInstance();
+		std::shared_ptr<cv::dnn::Net> first = registry.getNet(model);
+		std::shared_ptr<cv::dnn::Net> second = registry.getNet(model);
+		ASSERT_NE(first, nullptr);
+		ASSERT_EQ(first, second);
+
+		//A scope bound to a context gets the same network from any thread
+		const ModelRegistry::Context context = ModelRegistry::createContext();
+		std::shared_ptr<cv::dnn::Net> scoped;
+		{
+			ModelRegistry::ContextScope scope(context);
+			scoped = registry.getNet(model);
+		}
+		std::shared_ptr<cv::dnn::Net> fromThread;
+		std::thread([&]() {
+			ModelRegistry::ContextScope scope(context);
+			fromThread = registry.getNet(model);
+		}).join();
+		ASSERT_EQ(scoped, fromThread);
+		ASSERT_NE(scoped, first);
+	}
+
+	TEST_F(ModelRegistryTests, ThreadsGetDifferentNetworks) {
+		ModelRegistry& registry = ModelRegistry::getInstance();
+		std::shared_ptr<cv::dnn::Net> mine = registry.getNet(model);
+
+		//Networks are kept past the end of their threads, a later thread must not get the one of a finished thread
+		std::vector<std::shared_ptr<cv::dnn::Net>> others;
+		for (int i = 0; i < 3; i++) {
+			std::thread([&]() { others.push_back(registry.getNet(model)); }).join();
+		}
+
+		for (size_t i = 0; i < others.size(); i++) {
+			ASSERT_NE(others[i], mine);
+			for (size_t j = i + 1; j < others.size(); j++) {
+				ASSERT_NE(others[i], others[j]);
+			}
+		}
+	}
+
+	TEST_F(ModelRegistryTests, ReleasesNetworkWithLastUser) {
+		ModelRegistry& registry = ModelRegistry::getInstance();
+		std::shared_ptr<cv::dnn::Net> first = registry.getNet(model);
+		std::shared_ptr<cv::dnn::Net> second = registry.getNet(model);
+		std::weak_ptr<cv::dnn::Net> released = first;
+
+		first.reset();
+		ASSERT_FALSE(released.expired());
+		second.reset();
+		ASSERT_TRUE(released.expired());
+
+		//The next user loads it again
+		ASSERT_NE(registry.getNet(model), nullptr);
+	}
+}
@@ -0,0 +1,42 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/TextPrefilter.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include <opencv2/imgproc.hpp>
+
+namespace tik {
+	class TextPrefilterTests : public ::testing::Test {
+	protected:
+		TextPrefilterTests() : prefilter(PerformanceParams{}) {}
+
+		TextPrefilter prefilter;
+	};
+
+	TEST_F(TextPrefilterTests, SkipsBlackFrames) {
+		cv::Mat frame = cv::Mat::zeros(1080, 1920, CV_8UC3);
+
+		ASSERT_FALSE(prefilter.hasText(frame));
+		ASSERT_EQ(prefilter.getStats().framesSkipped, 1u);
+		ASSERT_EQ(prefilter.getStats().tilesBelowThreshold, prefilter.getStats().tilesEvaluated);
+	}
+
+	TEST_F(TextPrefilterTests, SkipsFlatGradients) {
+		cv::Mat frame(1080, 1920, CV_8UC3);
+		for (int row = 0; row < frame.rows; row++) {
+			frame.row(row).setTo(cv::Scalar::all(row * 255 / frame.rows));
+		}
+
+		ASSERT_FALSE(prefilter.hasText(frame));
+	}
+
+	TEST_F(TextPrefilterTests, KeepsFramesWithText) {
+		cv::Mat frame = cv::Mat::zeros(1080, 1920, CV_8UC3);
+		cv::putText(frame, "Press START to continue", cv::Point(100, 1000), cv::FONT_HERSHEY_SIMPLEX, 1.5, cv::Scalar::all(255), 3);
+
+		ASSERT_TRUE(prefilter.hasText(frame));
+		ASSERT_EQ(prefilter.getStats().framesEvaluated, 1u);
+		ASSERT_EQ(prefilter.getStats().framesSkipped, 0u);
+		ASSERT_LT(prefilter.getStats().tilesBelowThreshold, prefilter.getStats().tilesEvaluated);
+	}
+}
@@ -0,0 +1,82 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/RealTimeController.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+
+namespace tik {
+	class RealTimeControllerTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			params.frameBudgetMs = 10;
+		}
+
+		PerformanceParams params;
+	};
+
+	TEST_F(RealTimeControllerTests, DegradesStagesInOrderWhileOverBudget) {
+		RealTimeController controller(params);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_NONE);
+
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_COLORBLIND);
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_COLORBLIND | DEGRADED_RECOGNITION);
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_COLORBLIND | DEGRADED_RECOGNITION | DEGRADED_DETECTION);
+
+		//Nothing left to degrade
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_COLORBLIND | DEGRADED_RECOGNITION | DEGRADED_DETECTION);
+
+		ASSERT_EQ(controller.getStats().frames, 4u);
+		ASSERT_EQ(controller.getStats().framesOverBudget, 4u);
+		ASSERT_EQ(controller.getStats().degradedFrames, 3u);
+	}
+
+	TEST_F(RealTimeControllerTests, RestoresStagesWellUnderBudget) {
+		RealTimeController controller(params);
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_COLORBLIND);
+
+		//Under budget but not by enough to afford the skipped stage
+		for (int i = 0; i < 20; i++) {
+			controller.frameFinished(8);
+		}
+		ASSERT_EQ(controller.planFrame(), DEGRADED_COLORBLIND);
+
+		//The smoothed time takes a few frames to drop, then has to stay there for a while
+		for (int i = 0; i < 10; i++) {
+			controller.frameFinished(2);
+		}
+		ASSERT_EQ(controller.planFrame(), DEGRADED_COLORBLIND);
+		for (int i = 0; i < 10; i++) {
+			controller.frameFinished(2);
+		}
+		ASSERT_EQ(controller.planFrame(), DEGRADED_NONE);
+	}
+
+	TEST_F(RealTimeControllerTests, SkipsStagesTheMediaDoesntRun) {
+		RealTimeController controller(params);
+		controller.setAvailableStages(DEGRADED_RECOGNITION | DEGRADED_DETECTION);
+
+		//Videos have no colorblind frames, recognition is the first stage to go
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_RECOGNITION);
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_RECOGNITION | DEGRADED_DETECTION);
+
+		controller.setAvailableStages(DEGRADED_DETECTION);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_NONE);
+		controller.frameFinished(25);
+		ASSERT_EQ(controller.planFrame(), DEGRADED_DETECTION);
+	}
+
+	TEST(DegradedStagesTests, NamesEveryStage) {
+		ASSERT_TRUE(DegradedStagesAsStrings(DEGRADED_NONE).empty());
+		std::vector<std::string> names = DegradedStagesAsStrings(DEGRADED_COLORBLIND | DEGRADED_DETECTION);
+		ASSERT_EQ(names, (std::vector<std::string>{ "colorblind", "detection" }));
+	}
+}
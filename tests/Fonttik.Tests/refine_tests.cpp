@@ -0,0 +1,76 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/Configuration.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/Log.h"
+#include "../../src/TextboxDetectionEAST.h"
+
+namespace tik {
+	class RefineTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			config = Configuration("config/config_resolution.json");
+			params = config.getTextDetectionParams();
+			params.eastParams = { "frozen_east_text_detection.pb", 0.4f, 1.0, { 123.68, 116.78, 103.94 } };
+		}
+
+		std::vector<TextBox> detect(const cv::Mat& img, bool refine) {
+			TextDetectionParams detectionParams = params;
+			detectionParams.eastParams.refineHighResolution = refine;
+
+			TextboxDetectionEAST detection(detectionParams);
+			detection.init(config.getSbgrValues());
+			std::vector<TextBox> boxes = detection.detectBoxes(img);
+			for (TextBox& box : boxes) {
+				box.calculateTextBoxLuminance(config.getSbgrValues());
+				box.calculateTextMask();
+			}
+			return boxes;
+		}
+
+		//Every box found at full resolution must be found by the refine pass with the same text height
+		void compareWithFullResolution(const std::string& path) {
+			cv::Mat img = cv::imread(path);
+			ASSERT_FALSE(img.empty());
+
+			std::vector<TextBox> fullResolution = detect(img, false);
+			std::vector<TextBox> refined = detect(img, true);
+
+			ASSERT_FALSE(fullResolution.empty());
+			for (const TextBox& box : fullResolution) {
+				const TextBox* match = nullptr;
+				int bestOverlap = 0;
+				for (const TextBox& candidate : refined) {
+					int overlap = (box.getTextBoxRect() & candidate.getTextBoxRect()).area();
+					if (overlap > bestOverlap) {
+						bestOverlap = overlap;
+						match = &candidate;
+					}
+				}
+
+				ASSERT_NE(match, nullptr) << "No refined box for " << box.getTextBoxRect();
+				EXPECT_GT(bestOverlap, box.getTextBoxRect().area() / 2);
+				EXPECT_NEAR(match->getTextRect().height, box.getTextRect().height, HEIGHT_TOLERANCE);
+			}
+		}
+
+		const int HEIGHT_TOLERANCE = 2; //pixels
+
+		Configuration config;
+		TextDetectionParams params;
+	};
+
+	TEST_F(RefineTests, MatchesFullResolutionSans) {
+		compareWithFullResolution("config/sizes/4kSansPass.png");
+	}
+
+	TEST_F(RefineTests, MatchesFullResolutionSerif) {
+		compareWithFullResolution("config/sizes/4kSerifPass.png");
+	}
+
+	TEST_F(RefineTests, MatchesFullResolutionMeasuredSize) {
+		compareWithFullResolution("config/sizes/2160p-66x76.png");
+	}
+}
@@ -0,0 +1,71 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/BatchScheduler.hpp"
+#include "fonttik/Media.hpp"
+#include "fonttik/OutputManifest.hpp"
+#include "fonttik/Log.h"
+#include <fstream>
+#include <set>
+
+namespace tik {
+	class BatchSchedulerTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			config = Configuration("config/config_resolution.json");
+
+			root = fs::temp_directory_path() / "fonttik_scheduler_test";
+			fs::remove_all(root);
+			fs::create_directories(root / "nested");
+			fs::copy_file("config/sizes/720SansPass.png", root / "720SansPass.png");
+			fs::copy_file("config/sizes/1080SansPass.png", root / "1080SansPass.png");
+			fs::copy_file("config/sizes/1080SerifPass.png", root / "nested" / "1080SerifPass.png");
+		}
+
+		void TearDown() override {
+			fs::remove_all(root);
+		}
+
+		Configuration config;
+		fs::path root;
+	};
+
+	TEST_F(BatchSchedulerTests, AnalysesEveryFileIntoItsOwnOutput) {
+		BatchScheduler scheduler(config, 2);
+		std::set<fs::path> reported;
+		size_t lastCompleted = 0;
+		scheduler.setProgressCallback([&](const BatchScheduler::Progress& progress) {
+			reported.insert(progress.media);
+			ASSERT_EQ(progress.completed, lastCompleted + 1);
+			ASSERT_EQ(progress.total, 3u);
+			lastCompleted = progress.completed;
+		});
+
+		scheduler.addFolder(root);
+		ASSERT_EQ(scheduler.run(), 3u);
+		ASSERT_EQ(reported.size(), 3u);
+
+		for (const fs::path& media : reported) {
+			fs::path output = Media::getOutputPath(media.string());
+			ASSERT_TRUE(fs::exists(output / "sizeChecks.json"));
+			ASSERT_TRUE(fs::exists(output / OutputManifest::FILE_NAME));
+		}
+
+		//Everything is up to date now
+		BatchScheduler rerun(config, 2);
+		rerun.addFolder(root);
+		ASSERT_EQ(rerun.run(), 0u);
+	}
+
+	TEST_F(BatchSchedulerTests, UnsupportedFilesFail) {
+		std::ofstream(root / "notes.txt") << "not media";
+
+		BatchScheduler scheduler(config, 1);
+		scheduler.add(root / "notes.txt");
+		size_t failed = 0;
+		scheduler.setProgressCallback([&](const BatchScheduler::Progress& progress) { failed = progress.failed; });
+		ASSERT_EQ(scheduler.run(), 0u);
+		ASSERT_EQ(failed, 1u);
+	}
+}
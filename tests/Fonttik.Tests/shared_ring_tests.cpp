@@ -0,0 +1,89 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/SharedFrameRing.hpp"
+#include "fonttik/Log.h"
+#include <thread>
+#include <vector>
+
+namespace tik {
+	class SharedFrameRingTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+			writer = SharedFrameRing::create("fonttik_ring_tests", width, height, PixelFormat::BGR, 3);
+			ASSERT_NE(writer, nullptr);
+			reader = SharedFrameRing::open("fonttik_ring_tests");
+			ASSERT_NE(reader, nullptr);
+		}
+
+		void publish(uint8_t value, int frameIndex) {
+			std::vector<uint8_t> pixels(width * height * 3, value);
+			writer->publish(pixels.data(), width * 3, frameIndex, frameIndex * 10);
+		}
+
+		const int width = 5, height = 3;
+		std::unique_ptr<SharedFrameRing> writer;
+		std::unique_ptr<SharedFrameRing> reader;
+	};
+
+	TEST_F(SharedFrameRingTests, ReadsNewestFrameAndCountsDropped) {
+		publish(1, 0);
+		FrameBuffer frame;
+		ASSERT_TRUE(reader->acquireLatest(frame, 0));
+		ASSERT_EQ(frame.frameIndex, 0);
+
+		//Reader fell behind, only the newest frame is read
+		publish(2, 1);
+		publish(3, 2);
+		publish(4, 3);
+		ASSERT_TRUE(reader->acquireLatest(frame, 0));
+		ASSERT_EQ(frame.frameIndex, 3);
+		ASSERT_EQ(frame.msTimeStamp, 30);
+		ASSERT_EQ(frame.data[0], 4);
+		ASSERT_EQ(frame.stride, writer->getStride());
+		ASSERT_EQ(reader->getDroppedFrames(), 2u);
+
+		//Nothing newer yet
+		ASSERT_FALSE(reader->acquireLatest(frame, 10));
+	}
+
+	TEST_F(SharedFrameRingTests, WriterSkipsAcquiredSlot) {
+		publish(7, 0);
+		FrameBuffer frame;
+		ASSERT_TRUE(reader->acquireLatest(frame, 0));
+
+		for (int i = 1; i < 10; i++) {
+			publish(static_cast<uint8_t>(100 + i), i);
+		}
+
+		//The acquired frame is analysed in place and must stay intact
+		ASSERT_EQ(frame.data[0], 7);
+		ASSERT_EQ(frame.data[width * 3 - 1], 7);
+
+		ASSERT_TRUE(reader->acquireLatest(frame, 0));
+		ASSERT_EQ(frame.frameIndex, 9);
+		ASSERT_EQ(frame.data[0], 109);
+	}
+
+	TEST_F(SharedFrameRingTests, WakesUpOnPublishAndClose) {
+		std::thread producer([this]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			publish(5, 42);
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			writer->close();
+			});
+
+		FrameBuffer frame;
+		ASSERT_TRUE(reader->acquireLatest(frame));
+		ASSERT_EQ(frame.frameIndex, 42);
+		ASSERT_FALSE(reader->acquireLatest(frame));
+		producer.join();
+	}
+
+	TEST(SharedFrameRingValidationTests, RejectsInvalidRings) {
+		tik::Log::InitCoreLogger(false, false);
+		ASSERT_EQ(SharedFrameRing::create("fonttik_ring_invalid", 4, 4, PixelFormat::BGR, 2), nullptr);
+		ASSERT_EQ(SharedFrameRing::open("fonttik_ring_missing"), nullptr);
+	}
+}
@@ -5,6 +5,9 @@
 #include "fonttik/Configuration.hpp"
 #include "fonttik/Media.hpp"
 #include "fonttik/Log.h"
+#include "fonttik/ConfigurationParams.hpp"
+#include "fonttik/TextBox.hpp"
+#include "../../src/SizeChecker.hpp"
 
 namespace tik {
 	class SizeTests : public ::testing::Test {
@@ -92,5 +95,42 @@ namespace tik {
 		ASSERT_TRUE(passesSize("config/sizes/4kThinPass.png"));
 	}
 
+	//Stands in for the OCR model, counts the boxes it is asked to recognize
+	class CountingRecognition : public ITextBoxRecognition {
+	public:
+		virtual void init(const TextRecognitionParams& params) override {}
+		virtual std::string recognizeBox(TextBox& box) override { recognized++; return "gap"; }
 
-}
\ No newline at end of file
+		int recognized = 0;
+	};
+
+	TEST(LazyRecognitionTests, OnlyRecognizesBoxesUnderTheGuideline) {
+		Configuration config("config/config_resolution.json");
+		config.setUseOcr(true);
+		PerformanceParams params = config.getPerformanceParams();
+		params.lazyTextRecognition = true;
+		config.setPerformanceParams(params);
+
+		const SizeGuidelines* guideline = config.findResolutionGuideline("1080");
+		int minimumHeight = guideline->height;
+		cv::Mat frame(400, 400, CV_8UC3, cv::Scalar(0, 0, 0));
+		std::vector<TextBox> boxes = { TextBox(cv::Rect(10, 10, 100, minimumHeight + 10), frame), TextBox(cv::Rect(10, 300, 100, minimumHeight - 2), frame) };
+
+		CountingRecognition recognition;
+		SizeChecker checker(&config, &recognition);
+		checker.setGuideline(guideline);
+		FrameResults results = checker.check(0, boxes);
+		ASSERT_EQ(recognition.recognized, 1);
+		ASSERT_EQ(results.results[0].type, ResultType::PASS);
+		ASSERT_EQ(results.results[0].text, "");
+		ASSERT_EQ(results.results[1].type, ResultType::FAIL);
+		ASSERT_EQ(results.results[1].text, "gap");
+
+		//Full recognition reads every box
+		params.lazyTextRecognition = false;
+		config.setPerformanceParams(params);
+		boxes = { TextBox(cv::Rect(10, 10, 100, minimumHeight + 10), frame) };
+		checker.check(1, boxes);
+		ASSERT_EQ(recognition.recognized, 2);
+	}
+}
@@ -0,0 +1,114 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "fonttik/StreamMedia.hpp"
+#include "fonttik/Frame.hpp"
+#include "fonttik/Log.h"
+#include <fstream>
+#include <memory>
+
+namespace tik {
+	class StreamMediaTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			tik::Log::InitCoreLogger(false, false);
+		}
+
+		void TearDown() override {
+			fs::remove(path);
+		}
+
+		void writeStream(const std::string& header, const std::vector<std::vector<uint8_t>>& frames, const std::string& frameHeader = "") {
+			std::ofstream out(path, std::ios::binary);
+			out << header;
+			for (const std::vector<uint8_t>& frame : frames) {
+				out << frameHeader;
+				out.write(reinterpret_cast<const char*>(frame.data()), frame.size());
+			}
+		}
+
+		//Raw BGR frames of 4x2 pixels filled with their index
+		void writeRawFrames(int count) {
+			std::vector<std::vector<uint8_t>> frames;
+			for (int i = 0; i < count; i++) {
+				frames.emplace_back(4 * 2 * 3, static_cast<uint8_t>(i));
+			}
+			writeStream("", frames);
+		}
+
+		const std::string path = (fs::temp_directory_path() / "fonttik_stream_tests.raw").string();
+	};
+
+	TEST_F(StreamMediaTests, ReadsRawFramesInOrder) {
+		writeRawFrames(3);
+		std::unique_ptr<StreamMedia> media(StreamMedia::open(path, { { 4, 2 }, 10 }));
+		ASSERT_NE(media, nullptr);
+
+		for (int i = 0; i < 3; i++) {
+			ASSERT_TRUE(media->loadFrame());
+			Frame frame = media->getFrame();
+			ASSERT_EQ(frame.getFrameIndex(), i);
+			ASSERT_EQ(frame.getFrameMat().at<cv::Vec3b>(1, 3), cv::Vec3b(i, i, i));
+		}
+		ASSERT_FALSE(media->loadFrame());
+	}
+
+	TEST_F(StreamMediaTests, SkipsFramesByReadingPastThem) {
+		writeRawFrames(7);
+		std::unique_ptr<StreamMedia> media(StreamMedia::open(path, { { 4, 2 }, 4 }));
+		ASSERT_NE(media, nullptr);
+		media->setAnalysisWaitSeconds(1);
+
+		//Every third frame at 4 fps, as in videos
+		for (int expected : { 0, 3, 6 }) {
+			ASSERT_TRUE(media->loadFrame());
+			ASSERT_EQ(media->getFrame().getFrameIndex(), expected);
+		}
+		ASSERT_FALSE(media->loadFrame());
+	}
+
+	TEST_F(StreamMediaTests, IgnoresTruncatedLastFrame) {
+		writeStream("", { std::vector<uint8_t>(4 * 2 * 3, 1), std::vector<uint8_t>(5, 2) });
+		std::unique_ptr<StreamMedia> media(StreamMedia::open(path, { { 4, 2 } }));
+		ASSERT_NE(media, nullptr);
+
+		ASSERT_TRUE(media->loadFrame());
+		ASSERT_FALSE(media->loadFrame());
+	}
+
+	TEST_F(StreamMediaTests, ReadsY4MHeaderAndFrames) {
+		//White 4:2:0 frames, limited range
+		std::vector<uint8_t> white(4 * 2, 235);
+		white.insert(white.end(), 2 * 2, 128);
+		writeStream("YUV4MPEG2 W4 H2 F30000:1001 Ip A1:1 C420jpeg\n", { white, white }, "FRAME\n");
+
+		std::unique_ptr<StreamMedia> media(StreamMedia::open(path));
+		ASSERT_NE(media, nullptr);
+		ASSERT_EQ(media->getImageSize(), cv::Size(4, 2));
+		ASSERT_NEAR(media->getFps(), 29.97, 0.01);
+
+		ASSERT_TRUE(media->loadFrame());
+		ASSERT_TRUE(media->loadFrame());
+		ASSERT_GE(media->getFrame().getFrameMat().at<cv::Vec3b>(0, 0)[1], 250);
+		ASSERT_FALSE(media->loadFrame());
+	}
+
+	TEST_F(StreamMediaTests, ReadsY4MMonoFrames) {
+		writeStream("YUV4MPEG2 W3 H1 F25:1 Cmono\n", { { 10, 20, 30 } }, "FRAME\n");
+
+		std::unique_ptr<StreamMedia> media(StreamMedia::open(path));
+		ASSERT_NE(media, nullptr);
+		ASSERT_TRUE(media->loadFrame());
+		ASSERT_EQ(media->getFrame().getFrameMat().at<cv::Vec3b>(0, 2), cv::Vec3b(30, 30, 30));
+	}
+
+	TEST_F(StreamMediaTests, RejectsStreamsItCantRead) {
+		writeRawFrames(1);
+		ASSERT_EQ(StreamMedia::open(path), nullptr); //no frame size and no y4m header
+
+		writeStream("YUV4MPEG2 W4 H2 F25:1 C420p10\n", {});
+		ASSERT_EQ(StreamMedia::open(path), nullptr);
+
+		ASSERT_EQ(StreamMedia::open("fonttik_missing_stream"), nullptr);
+	}
+}
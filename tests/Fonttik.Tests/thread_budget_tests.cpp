@@ -0,0 +1,60 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/ThreadBudget.hpp"
+#include <opencv2/core.hpp>
+
+namespace tik {
+	//Every test uses its own budget, only OpenCV's process wide thread count has to be restored
+	class ThreadBudgetTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			openCVThreads = cv::getNumThreads();
+			budget.configure(4, false);
+		}
+
+		void TearDown() override {
+			cv::setNumThreads(openCVThreads);
+		}
+
+		ThreadBudget budget;
+		int openCVThreads = 0;
+	};
+
+	TEST_F(ThreadBudgetTests, LeasesShareTheBudget) {
+		{
+			ThreadBudget::Lease first = budget.acquire(3);
+			ASSERT_EQ(first.size(), 3);
+			ASSERT_EQ(cv::getNumThreads(), 1);
+
+			//Only one thread is left, the calling thread always counts
+			ThreadBudget::Lease second = budget.acquire(3);
+			ASSERT_EQ(second.size(), 2);
+			ThreadBudget::Lease third = budget.acquire(2);
+			ASSERT_EQ(third.size(), 1);
+		}
+
+		//Everything was returned
+		ThreadBudget::Lease whole = budget.acquire(8);
+		ASSERT_EQ(whole.size(), 4);
+	}
+
+	TEST_F(ThreadBudgetTests, OpenCVGetsTheBudgetOfEachThread) {
+		ASSERT_EQ(cv::getNumThreads(), 4);
+		{
+			ThreadBudget::Lease pair = budget.acquire(2);
+			ASSERT_EQ(cv::getNumThreads(), 2);
+		}
+		ASSERT_EQ(cv::getNumThreads(), 4);
+	}
+
+	TEST_F(ThreadBudgetTests, DefaultBudgetIsApplied) {
+		cv::setNumThreads(1);
+
+		//The default budget matches the initial state, configuring it must still set OpenCV's thread count
+		ThreadBudget defaultBudget;
+		defaultBudget.configure(0, false);
+		ASSERT_GE(defaultBudget.getThreads(), 1);
+		ASSERT_EQ(cv::getNumThreads(), defaultBudget.getThreads());
+	}
+}
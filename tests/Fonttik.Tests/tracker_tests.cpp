@@ -0,0 +1,117 @@
+//Copyright (C) 2026 Electronic Arts, Inc.  All rights reserved.
+
+#include <gtest/gtest.h>
+#include "../../src/BoxTracker.hpp"
+#include "fonttik/ConfigurationParams.hpp"
+
+namespace tik {
+	class BoxTrackerTests : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			params.boxTracking = true;
+			params.trackingMinIoU = 0.5f;
+
+			frame = cv::Mat(200, 400, CV_8UC3, cv::Scalar(30, 30, 30));
+			frame(first).setTo(cv::Scalar(255, 255, 255));
+			frame(second).setTo(cv::Scalar(0, 0, 255));
+		}
+
+		//Stands in for a checker, one result per box in the given order
+		FrameResults check(int frameIndex, const std::vector<TextBox>& boxes) {
+			FrameResults results(frameIndex);
+			for (const TextBox& box : boxes) {
+				results.results.push_back(ResultBox(ResultType::FAIL, box.getTextBoxRect(), 2.0));
+				results.results.back().passes = false;
+				results.overallPass = false;
+			}
+			return results;
+		}
+
+		//Runs a whole frame through the tracker, returning the number of boxes that had to be checked
+		size_t track(BoxTracker& tracker, const cv::Mat& image, int frameIndex, FrameResults& results) {
+			std::vector<TextBox> boxes = tracker.match({ TextBox(first, image), TextBox(second, image) }, CONTRAST_CHECK);
+			results = check(frameIndex, boxes);
+			tracker.complete(results, CONTRAST_CHECK);
+			return boxes.size();
+		}
+
+		int trackOf(const FrameResults& results, const cv::Rect& rect) {
+			for (const ResultBox& box : results.results) {
+				if (cv::Rect(box.x, box.y, box.width, box.height) == rect) {
+					return box.trackId;
+				}
+			}
+			return -1;
+		}
+
+		PerformanceParams params;
+		cv::Mat frame;
+		const cv::Rect first{ 20, 20, 100, 30 };
+		const cv::Rect second{ 200, 120, 150, 40 };
+	};
+
+	TEST_F(BoxTrackerTests, ReusesUnchangedBoxes) {
+		BoxTracker tracker(params);
+		FrameResults results(0);
+		ASSERT_EQ(track(tracker, frame, 0, results), 2u);
+		int firstTrack = trackOf(results, first);
+		int secondTrack = trackOf(results, second);
+		ASSERT_NE(firstTrack, secondTrack);
+
+		ASSERT_EQ(track(tracker, frame.clone(), 1, results), 0u);
+		ASSERT_EQ(results.results.size(), 2u);
+		ASSERT_EQ(trackOf(results, first), firstTrack);
+		ASSERT_EQ(trackOf(results, second), secondTrack);
+		ASSERT_FALSE(results.overallPass);
+		ASSERT_EQ(results.overallType, ResultType::FAIL);
+		for (const ResultBox& box : results.results) {
+			ASSERT_EQ(box.measuredFrame, 0);
+		}
+		ASSERT_EQ(tracker.getStats().reusedBoxes, 2u);
+	}
+
+	TEST_F(BoxTrackerTests, ChecksChangedBoxesAgain) {
+		BoxTracker tracker(params);
+		FrameResults results(0);
+		track(tracker, frame, 0, results);
+		int secondTrack = trackOf(results, second);
+
+		cv::Mat next = frame.clone();
+		next(cv::Rect(210, 130, 20, 10)).setTo(cv::Scalar(0, 255, 0));
+
+		ASSERT_EQ(track(tracker, next, 1, results), 1u);
+		ASSERT_EQ(trackOf(results, second), secondTrack);
+		ASSERT_EQ(tracker.getStats().matchedBoxes, 2u);
+		ASSERT_EQ(tracker.getStats().reusedBoxes, 1u);
+	}
+
+	TEST_F(BoxTrackerTests, MovedBoxesStartNewTracks) {
+		BoxTracker tracker(params);
+		FrameResults results(0);
+		std::vector<TextBox> boxes = tracker.match({ TextBox(first, frame) }, SIZE_CHECK);
+		results = check(0, boxes);
+		tracker.complete(results, SIZE_CHECK);
+		int firstTrack = results.results[0].trackId;
+
+		//Slightly moved keeps the track but is checked again
+		cv::Rect shifted = first + cv::Point(4, 0);
+		ASSERT_EQ(tracker.match({ TextBox(shifted, frame) }, SIZE_CHECK).size(), 1u);
+		results = check(1, { TextBox(shifted, frame) });
+		tracker.complete(results, SIZE_CHECK);
+		ASSERT_EQ(results.results[0].trackId, firstTrack);
+
+		//Far away starts a new one
+		cv::Rect moved = first + cv::Point(150, 100);
+		tracker.match({ TextBox(moved, frame) }, SIZE_CHECK);
+		results = check(2, { TextBox(moved, frame) });
+		tracker.complete(results, SIZE_CHECK);
+		ASSERT_NE(results.results[0].trackId, firstTrack);
+		ASSERT_EQ(tracker.getStats().newTracks, 2u);
+	}
+
+	TEST(BoxTrackerIoUTests, IntersectionOverUnion) {
+		ASSERT_FLOAT_EQ(BoxTracker::intersectionOverUnion(cv::Rect(0, 0, 10, 10), cv::Rect(0, 0, 10, 10)), 1.0f);
+		ASSERT_FLOAT_EQ(BoxTracker::intersectionOverUnion(cv::Rect(0, 0, 10, 10), cv::Rect(5, 0, 10, 10)), 50.0f / 150.0f);
+		ASSERT_FLOAT_EQ(BoxTracker::intersectionOverUnion(cv::Rect(0, 0, 10, 10), cv::Rect(20, 0, 10, 10)), 0.0f);
+	}
+}
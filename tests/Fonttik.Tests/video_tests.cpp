@@ -3,8 +3,14 @@
 #include <gtest/gtest.h>
 #include "fonttik/Media.hpp"
 #include "../src/Video.hpp"
+#include "fonttik/Fonttik.hpp"
+#include "fonttik/Configuration.hpp"
+#include "fonttik/ConfigurationParams.hpp"
 #include "fonttik/Results.h"
 #include "fonttik/Log.h"
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
 
 namespace tik {
 	class VideoTests : public ::testing::Test {
@@ -28,6 +34,63 @@ namespace tik {
 		ASSERT_FALSE(checkSimilarity(path));
 	}
 
+	TEST_F(VideoTests, FrameRangeStopsAtSegmentEnd) {
+		tik::Log::InitCoreLogger(false, false);
+		tik::Video* video = static_cast<tik::Video*>(tik::Media::createMedia("config/Video/LowSimilarity.gif"));
+		video->setFrameRange(0, 1);
+		ASSERT_EQ(video->getStartFrame(), 0);
+
+		ASSERT_TRUE(video->loadFrame());
+		ASSERT_EQ(video->getFrame().getFrameIndex(), 0);
+		//The next different frame belongs to the next segment
+		ASSERT_FALSE(video->loadFrame());
+		delete video;
+	}
+
+	TEST_F(VideoTests, SegmentsMatchSequentialAnalysis) {
+		tik::Log::InitCoreLogger(false, false);
+
+		//Blocks of 40 equal frames at 30 fps, analysing every second the second segment starts off the frames a sequential run picks
+		cv::Mat image;
+		cv::resize(cv::imread("config/sizes/720SansPass.png"), image, cv::Size(320, 180));
+		const cv::Mat variants[] = { image, ~image };
+		const fs::path path = fs::temp_directory_path() / "fonttik_segments_test.avi";
+		{
+			cv::VideoWriter writer(path.string(), cv::VideoWriter::fourcc('M', 'J', 'P', 'G'), 30, image.size());
+			ASSERT_TRUE(writer.isOpened());
+			for (int i = 0; i < 1320; i++) {
+				writer << variants[(i / 40) % 2];
+			}
+		}
+
+		Configuration config("config/config_resolution.json");
+		config.setTargetResolution("720");
+		config.setAnalysisWaitSeconds(1);
+		auto analyse = [&config, &path](int segments) {
+			PerformanceParams params = config.getPerformanceParams();
+			params.videoSegments = segments;
+			config.setPerformanceParams(params);
+
+			Fonttik fonttik(&config);
+			Video video(path.string());
+			return fonttik.processMedia(video).getSizeResults();
+		};
+		std::vector<FrameResults> sequential = analyse(1);
+		std::vector<FrameResults> segmented = analyse(2);
+		fs::remove(path);
+
+		ASSERT_EQ(segmented.size(), sequential.size());
+		for (size_t i = 0; i < sequential.size(); i++) {
+			ASSERT_EQ(segmented[i].frame, sequential[i].frame);
+			ASSERT_EQ(segmented[i].results.size(), sequential[i].results.size());
+			for (size_t j = 0; j < sequential[i].results.size(); j++) {
+				ASSERT_EQ(segmented[i].results[j].x, sequential[i].results[j].x);
+				ASSERT_EQ(segmented[i].results[j].y, sequential[i].results[j].y);
+				ASSERT_EQ(segmented[i].results[j].height, sequential[i].results[j].height);
+			}
+		}
+	}
+
 	class FrameSorting : public ::testing::Test {
 	protected:
 		Results r;